@@ -0,0 +1,169 @@
+//! Criterion benchmarks for the hot FFI entry points.
+//!
+//! These exercise the same exported functions the generated bindings call, so a regression
+//! here (an extra copy in `blobs_add_bytes`, slower dispatch in a callback loop, ...) shows
+//! up as a criterion diff instead of a production incident. Run with `cargo bench`; criterion
+//! stores baselines under `target/criterion` so results are comparable across commits.
+//!
+//! All benchmarks run against an in-memory node, so the numbers measure the FFI layer and the
+//! store engine without fsync noise. Payload sizes default to 1 KiB – 16 MiB; set
+//! `IROH_BENCH_LARGE=1` to extend the transfer benches up to 1 GiB.
+
+use std::sync::Arc;
+
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use rand::RngCore;
+
+// `iroh_ffi` is this crate's self-dependency alias; plain `iroh` would be ambiguous with
+// the upstream `iroh` dependency, which the build also passes to the bench target
+use iroh_ffi::{CallbackError, Hash, HashBatchCallback, IrohNode, Query};
+
+const SIZES: &[usize] = &[1024, 64 * 1024, 1024 * 1024, 16 * 1024 * 1024];
+const LARGE_SIZES: &[usize] = &[256 * 1024 * 1024, 1024 * 1024 * 1024];
+
+fn sizes() -> Vec<usize> {
+    let mut sizes = SIZES.to_vec();
+    if std::env::var("IROH_BENCH_LARGE").is_ok() {
+        sizes.extend_from_slice(LARGE_SIZES);
+    }
+    sizes
+}
+
+/// A payload of `size` bytes that differs per call, so the store cannot dedup the ingest.
+fn unique_payload(size: usize, counter: &mut u64) -> Vec<u8> {
+    let mut bytes = vec![0xab; size];
+    *counter += 1;
+    bytes[..8].copy_from_slice(&counter.to_le_bytes());
+    bytes
+}
+
+fn bench_blobs_add_bytes(c: &mut Criterion) {
+    let node = IrohNode::memory().unwrap();
+
+    let mut group = c.benchmark_group("blobs_add_bytes");
+    group.sample_size(20);
+    let mut counter = 0u64;
+    for size in sizes() {
+        group.throughput(Throughput::Bytes(size as u64));
+        group.bench_with_input(BenchmarkId::from_parameter(size), &size, |b, &size| {
+            b.iter_batched(
+                || unique_payload(size, &mut counter),
+                |bytes| node.blobs_add_bytes(bytes).unwrap(),
+                criterion::BatchSize::PerIteration,
+            )
+        });
+    }
+    group.finish();
+}
+
+fn bench_blobs_read_to_bytes(c: &mut Criterion) {
+    let node = IrohNode::memory().unwrap();
+
+    let mut group = c.benchmark_group("blobs_read_to_bytes");
+    group.sample_size(20);
+    let mut counter = 0u64;
+    for size in sizes() {
+        let hash = node
+            .blobs_add_bytes(unique_payload(size, &mut counter))
+            .unwrap()
+            .hash;
+        group.throughput(Throughput::Bytes(size as u64));
+        group.bench_with_input(BenchmarkId::from_parameter(size), &hash, |b, hash| {
+            b.iter(|| node.blobs_read_to_bytes(hash.clone()).unwrap())
+        });
+    }
+    group.finish();
+}
+
+fn bench_doc_set_bytes(c: &mut Criterion) {
+    let node = IrohNode::memory().unwrap();
+    let doc = node.doc_create().unwrap();
+    let author = node.author_create().unwrap();
+
+    let value = vec![0xcd; 1024];
+    let mut counter = 0u64;
+    let mut group = c.benchmark_group("doc_set_bytes");
+    group.throughput(Throughput::Bytes(value.len() as u64));
+    group.bench_function("1024", |b| {
+        b.iter(|| {
+            counter += 1;
+            doc.set_bytes(
+                &author,
+                counter.to_le_bytes().to_vec(),
+                value.clone(),
+            )
+            .unwrap()
+        })
+    });
+    group.finish();
+}
+
+fn bench_doc_get_many(c: &mut Criterion) {
+    let node = IrohNode::memory().unwrap();
+    let doc = node.doc_create().unwrap();
+    let author = node.author_create().unwrap();
+
+    let num_entries = 10_000u64;
+    let mut value = vec![0u8; 64];
+    for i in 0..num_entries {
+        rand::thread_rng().fill_bytes(&mut value);
+        doc.set_bytes(&author, i.to_le_bytes().to_vec(), value.clone())
+            .unwrap();
+    }
+
+    let mut group = c.benchmark_group("doc_get_many");
+    group.sample_size(20);
+    group.throughput(Throughput::Elements(num_entries));
+    group.bench_function("all_10k", |b| {
+        b.iter(|| {
+            let entries = doc.get_many(Arc::new(Query::all(None))).unwrap();
+            assert_eq!(entries.len(), num_entries as usize);
+            entries
+        })
+    });
+    group.finish();
+}
+
+fn bench_callback_dispatch(c: &mut Criterion) {
+    let node = IrohNode::memory().unwrap();
+
+    let num_blobs = 1000u64;
+    let mut counter = 0u64;
+    for _ in 0..num_blobs {
+        node.blobs_add_bytes(unique_payload(64, &mut counter))
+            .unwrap();
+    }
+
+    struct NoopCallback;
+    impl HashBatchCallback for NoopCallback {
+        fn batch(&self, hashes: Vec<Arc<Hash>>) -> Result<(), CallbackError> {
+            criterion::black_box(hashes);
+            Ok(())
+        }
+    }
+
+    // one crossing per hash vs one crossing per batch: the spread between these two is the
+    // per-dispatch overhead the batched APIs exist to amortize
+    let mut group = c.benchmark_group("callback_dispatch");
+    group.throughput(Throughput::Elements(num_blobs));
+    group.bench_function("list_batched_1", |b| {
+        b.iter(|| node.blobs_list_batched(1, Arc::new(NoopCallback)).unwrap())
+    });
+    group.bench_function("list_batched_256", |b| {
+        b.iter(|| {
+            node.blobs_list_batched(256, Arc::new(NoopCallback))
+                .unwrap()
+        })
+    });
+    group.finish();
+}
+
+criterion_group!(
+    benches,
+    bench_blobs_add_bytes,
+    bench_blobs_read_to_bytes,
+    bench_doc_set_bytes,
+    bench_doc_get_many,
+    bench_callback_dispatch
+);
+criterion_main!(benches);
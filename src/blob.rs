@@ -9,7 +9,7 @@ use futures::{StreamExt, TryStreamExt};
 use serde::{Deserialize, Serialize};
 
 use crate::ticket::AddrInfoOptions;
-use crate::{block_on, IrohError, NodeAddr};
+use crate::{block_on, spawn_on, IrohError, NodeAddr};
 use crate::{node::IrohNode, CallbackError};
 
 impl IrohNode {
@@ -30,6 +30,118 @@ impl IrohNode {
         })
     }
 
+    /// List the hashes of all complete blobs as one flat byte buffer.
+    ///
+    /// The buffer holds the raw 32-byte hashes back to back, so a store of any size lists
+    /// with a single allocation and no per-hash `Hash` object handles. Pair with the `_raw`
+    /// method variants to keep hashes by value on the foreign side.
+    pub fn blobs_list_raw(&self) -> Result<Vec<u8>, IrohError> {
+        block_on(&self.rt(), async {
+            let mut response = self.sync_client.blobs().list().await?;
+
+            let mut hashes = Vec::new();
+            while let Some(info) = response.next().await {
+                hashes.extend_from_slice(info?.hash.as_bytes());
+            }
+            Ok(hashes)
+        })
+    }
+
+    /// Get the size information on a single blob.
+    ///
+    /// Raw-hash variant of [`Self::blobs_size`]: takes the 32-byte hash by value instead of
+    /// a `Hash` object handle.
+    pub fn blobs_size_raw(&self, hash: Vec<u8>) -> Result<u64, IrohError> {
+        let hash = Hash::from_bytes(hash)?;
+        self.blobs_size(&hash)
+    }
+
+    /// Read all bytes of single blob at `offset` for length `len`.
+    ///
+    /// Raw-hash variant of [`Self::blobs_read_at_to_bytes`]: takes the 32-byte hash by value
+    /// instead of a `Hash` object handle.
+    pub fn blobs_read_at_to_bytes_raw(
+        &self,
+        hash: Vec<u8>,
+        offset: u64,
+        len: Option<u64>,
+    ) -> Result<Vec<u8>, IrohError> {
+        let hash = Hash::from_bytes(hash)?;
+        self.blobs_read_at_to_bytes(Arc::new(hash), offset, len)
+    }
+
+    /// Delete a blob.
+    ///
+    /// Raw-hash variant of [`Self::blobs_delete_blob`]: takes the 32-byte hash by value
+    /// instead of a `Hash` object handle.
+    pub fn blobs_delete_blob_raw(&self, hash: Vec<u8>) -> Result<(), IrohError> {
+        let hash = Hash::from_bytes(hash)?;
+        self.blobs_delete_blob(Arc::new(hash))
+    }
+
+    /// Look up size and completeness for many hashes in a single call.
+    ///
+    /// Unlike [`Self::blobs_size`], which answers one hash per blocking call, this answers
+    /// every given hash in one crossing: whether the blob is complete, partial or missing,
+    /// and its (current) size in bytes. Each hash is probed individually with bounded
+    /// concurrency, so the cost scales with the batch rather than with the size of the
+    /// store. The results come back in the same order as the given hashes. Only a
+    /// definitive not-found is reported as `Missing`; a probe failing for any other reason
+    /// (store or rpc trouble) fails the whole call instead of feigning absent data.
+    pub fn blobs_status_batch(
+        &self,
+        hashes: Vec<Arc<Hash>>,
+    ) -> Result<Vec<BlobStatusInfo>, IrohError> {
+        block_on(&self.rt(), async {
+            let mut results = futures::stream::iter(hashes.into_iter().map(|hash| {
+                let client = self.sync_client.clone();
+                async move {
+                    match client.blobs().read(hash.0).await {
+                        Ok(reader) => Ok::<_, IrohError>(BlobStatusInfo {
+                            hash,
+                            status: BlobStatus::Complete,
+                            size: reader.size(),
+                        }),
+                        // `read` reports absent (and not-yet-complete) hashes as not
+                        // found; any other failure is a transient store/rpc error and
+                        // must not masquerade as missing data to a replication auditor
+                        Err(err) if err.to_string().to_lowercase().contains("not found") => {
+                            Ok(BlobStatusInfo {
+                                hash,
+                                status: BlobStatus::Missing,
+                                size: 0,
+                            })
+                        }
+                        Err(err) => Err(err.into()),
+                    }
+                }
+            }))
+            .buffered(16)
+            .try_collect::<Vec<_>>()
+            .await?;
+
+            // a failed probe can mean partial rather than missing; resolve those with one
+            // pass over the incomplete listing, keeping only entries we were asked about
+            let unresolved: std::collections::HashMap<iroh::blobs::Hash, usize> = results
+                .iter()
+                .enumerate()
+                .filter(|(_, info)| matches!(info.status, BlobStatus::Missing))
+                .map(|(i, info)| (info.hash.0, i))
+                .collect();
+            if !unresolved.is_empty() {
+                let mut response = self.sync_client.blobs().list_incomplete().await?;
+                while let Some(info) = response.next().await {
+                    let info = info?;
+                    if let Some(&i) = unresolved.get(&info.hash) {
+                        results[i].status = BlobStatus::Partial;
+                        results[i].size = info.size;
+                    }
+                }
+            }
+            Ok(results)
+        })
+    }
+
     /// Get the size information on a single blob.
     ///
     /// Method only exists in FFI
@@ -46,7 +158,8 @@ impl IrohNode {
     /// reading is small. If not sure, use [`Self::blobs_size`] and check the size with
     /// before calling [`Self::blobs_read_to_bytes`].
     pub fn blobs_read_to_bytes(&self, hash: Arc<Hash>) -> Result<Vec<u8>, IrohError> {
-        block_on(&self.rt(), async {
+        let start = std::time::Instant::now();
+        let res = block_on(&self.rt(), async {
             let res = self
                 .sync_client
                 .blobs()
@@ -54,7 +167,9 @@ impl IrohNode {
                 .await
                 .map(|b| b.to_vec())?;
             Ok(res)
-        })
+        });
+        crate::node::ffi_histogram(&crate::FfiMetric::BlobsReadToBytes).record(start.elapsed());
+        res
     }
 
     /// Read all bytes of single blob at `offset` for length `len`.
@@ -83,6 +198,92 @@ impl IrohNode {
         })
     }
 
+    /// Read a blob range directly into a caller-provided buffer.
+    ///
+    /// Unlike [`Self::blobs_read_at_to_bytes`], which lowers the content as a fresh byte
+    /// buffer on every call, this writes into the memory at `ptr` (a writable buffer of at
+    /// least `capacity` bytes, valid for the duration of the call) and returns the number of
+    /// bytes written. The caller can reuse one buffer across any number of reads, so
+    /// steady-state small reads cost no per-call allocation at the FFI boundary. Errors if
+    /// the requested range does not fit in `capacity`.
+    pub fn blobs_read_at_into(
+        &self,
+        hash: Arc<Hash>,
+        offset: u64,
+        len: Option<u64>,
+        ptr: u64,
+        capacity: u64,
+    ) -> Result<u64, IrohError> {
+        let len = match len {
+            None => None,
+            Some(l) => Some(usize::try_from(l).map_err(anyhow::Error::from)?),
+        };
+        block_on(&self.rt(), async {
+            let res = self
+                .sync_client
+                .blobs()
+                .read_at_to_bytes(hash.0, offset, len)
+                .await?;
+            if res.len() as u64 > capacity {
+                return Err(anyhow::anyhow!(
+                    "buffer too small: need {} bytes, capacity is {}",
+                    res.len(),
+                    capacity
+                )
+                .into());
+            }
+            unsafe {
+                std::ptr::copy_nonoverlapping(res.as_ptr(), ptr as *mut u8, res.len());
+            }
+            Ok(res.len() as u64)
+        })
+    }
+
+    /// Read all bytes of single blob.
+    ///
+    /// Async variant of [`Self::blobs_read_to_bytes`]: surfaces as a pollable future over the
+    /// FFI instead of blocking the calling thread, and can be cancelled via the rust-future
+    /// cancellation hooks.
+    pub async fn blobs_read_to_bytes_async(&self, hash: Arc<Hash>) -> Result<Vec<u8>, IrohError> {
+        let client = self.sync_client.clone();
+        spawn_on(&self.rt(), async move {
+            let res = client
+                .blobs()
+                .read_to_bytes(hash.0)
+                .await
+                .map(|b| b.to_vec())?;
+            Ok(res)
+        })
+        .await
+    }
+
+    /// Read all bytes of single blob at `offset` for length `len`.
+    ///
+    /// Async variant of [`Self::blobs_read_at_to_bytes`]: surfaces as a pollable future over
+    /// the FFI instead of blocking the calling thread, and can be cancelled via the rust-future
+    /// cancellation hooks.
+    pub async fn blobs_read_at_to_bytes_async(
+        &self,
+        hash: Arc<Hash>,
+        offset: u64,
+        len: Option<u64>,
+    ) -> Result<Vec<u8>, IrohError> {
+        let len = match len {
+            None => None,
+            Some(l) => Some(usize::try_from(l).map_err(anyhow::Error::from)?),
+        };
+        let client = self.sync_client.clone();
+        spawn_on(&self.rt(), async move {
+            let res = client
+                .blobs()
+                .read_at_to_bytes(hash.0, offset, len)
+                .await
+                .map(|b| b.to_vec())?;
+            Ok(res)
+        })
+        .await
+    }
+
     /// Import a blob from a filesystem path.
     ///
     /// `path` should be an absolute path valid for the file system on which
@@ -116,6 +317,197 @@ impl IrohNode {
         })
     }
 
+    /// Import a blob from a filesystem path, with throttled progress reporting.
+    ///
+    /// Behaves like [`Self::blobs_add_from_path`], but `Progress` events are coalesced: one
+    /// is only forwarded once `min_interval_millis` has passed since the last forwarded one
+    /// and at least `min_bytes_delta` bytes accumulated. Either threshold can be 0 to
+    /// disable it, so `min_bytes_delta = 0` gives a pure per-interval rate limit. All
+    /// other events (`Found`, `Done`, `AllDone`, `Abort`) are always delivered, so the final
+    /// state is exact while bulk transfers cost a bounded number of callback crossings.
+    #[allow(clippy::too_many_arguments)]
+    pub fn blobs_add_from_path_throttled(
+        &self,
+        path: String,
+        in_place: bool,
+        tag: Arc<SetTagOption>,
+        wrap: Arc<WrapOption>,
+        cb: Arc<dyn AddCallback>,
+        min_bytes_delta: u64,
+        min_interval_millis: u64,
+    ) -> Result<(), IrohError> {
+        block_on(&self.rt(), async {
+            let mut stream = self
+                .sync_client
+                .blobs()
+                .add_from_path(
+                    path.into(),
+                    in_place,
+                    (*tag).clone().into(),
+                    (*wrap).clone().into(),
+                )
+                .await?;
+            let mut throttle = ProgressThrottle::new(min_bytes_delta, min_interval_millis);
+            while let Some(progress) = stream.next().await {
+                let progress: AddProgress = progress?.into();
+                if let AddProgress::Progress(ref p) = progress {
+                    if !throttle.admit(p.id, p.offset) {
+                        continue;
+                    }
+                }
+                cb.progress(Arc::new(progress))?;
+            }
+            Ok(())
+        })
+    }
+
+    /// Import a directory tree with parallel workers and a single collection commit.
+    ///
+    /// Walks `path` recursively, hashes and ingests the files with up to `worker_count`
+    /// concurrent imports, and commits one [`Collection`] (tagged with `tag`) once all files
+    /// are in the store. Progress is reported through the usual [`AddCallback`] events:
+    /// `Found` and `Done` per file (with the file's index as id) and a final `AllDone` with
+    /// the collection hash.
+    pub fn blobs_import_directory(
+        &self,
+        path: String,
+        worker_count: u32,
+        tag: Arc<SetTagOption>,
+        cb: Arc<dyn AddCallback>,
+    ) -> Result<HashAndTag, IrohError> {
+        let worker_count = worker_count.max(1) as usize;
+        let root = PathBuf::from(path);
+        let mut files = Vec::new();
+        collect_files(&root, &root, &mut files)?;
+        files.sort();
+
+        block_on(&self.rt(), async {
+            let mut results = futures::stream::iter(files.into_iter().enumerate().map(
+                |(id, (name, path))| {
+                    let client = self.sync_client.clone();
+                    let cb = cb.clone();
+                    async move {
+                        let size = tokio::fs::metadata(&path)
+                            .await
+                            .map_err(anyhow::Error::from)?
+                            .len();
+                        cb.progress(Arc::new(AddProgress::Found(AddProgressFound {
+                            id: id as u64,
+                            name: name.clone(),
+                            size,
+                        })))?;
+
+                        let mut stream = client
+                            .blobs()
+                            .add_from_path(
+                                path,
+                                false,
+                                iroh::blobs::util::SetTagOption::Auto,
+                                iroh::client::blobs::WrapOption::NoWrap,
+                            )
+                            .await?;
+                        let mut outcome = None;
+                        while let Some(progress) = stream.next().await {
+                            match progress? {
+                                iroh::blobs::provider::AddProgress::AllDone {
+                                    hash, tag, ..
+                                } => {
+                                    outcome = Some((hash, tag));
+                                }
+                                iroh::blobs::provider::AddProgress::Abort(err) => {
+                                    return Err(IrohError::from(anyhow::anyhow!("{}", err)));
+                                }
+                                _ => {}
+                            }
+                        }
+                        let (hash, tag) = outcome.ok_or_else(|| {
+                            anyhow::anyhow!("import of {} did not complete", name)
+                        })?;
+                        cb.progress(Arc::new(AddProgress::Done(AddProgressDone {
+                            id: id as u64,
+                            hash: Arc::new(hash.into()),
+                        })))?;
+                        Ok::<_, IrohError>((name, hash, tag))
+                    }
+                },
+            ))
+            .buffer_unordered(worker_count)
+            .try_collect::<Vec<_>>()
+            .await?;
+
+            // one collection commit for the whole import; the per-file auto tags are
+            // released once the collection holds the blobs
+            results.sort_by(|a, b| a.0.cmp(&b.0));
+            let mut collection = iroh::blobs::format::collection::Collection::default();
+            let mut tags_to_delete = Vec::new();
+            for (name, hash, file_tag) in results {
+                collection.push(name, hash);
+                tags_to_delete.push(file_tag);
+            }
+            let (hash, tag) = self
+                .sync_client
+                .blobs()
+                .create_collection(collection, (*tag).clone().into(), tags_to_delete)
+                .await?;
+
+            cb.progress(Arc::new(AddProgress::AllDone(AddProgressAllDone {
+                hash: Arc::new(hash.into()),
+                format: BlobFormat::HashSeq,
+                tag: tag.0.to_vec(),
+            })))?;
+            Ok(HashAndTag {
+                hash: Arc::new(hash.into()),
+                tag: tag.0.to_vec(),
+            })
+        })
+    }
+
+    /// Stream the content of a blob to a foreign writer callback.
+    ///
+    /// The `write` method of `writer` is invoked with verified chunks of up to `chunk_size`
+    /// bytes (default 64 KiB if 0), in order, until the whole blob has been delivered — no
+    /// temp file and only the one copy into the chunk buffer. The stream is pull-based: the
+    /// next chunk is only read once the callback returns, so a slow consumer exerts
+    /// backpressure, and returning an error from the callback aborts the transfer.
+    pub fn blobs_write_to_callback(
+        &self,
+        hash: Arc<Hash>,
+        chunk_size: u32,
+        writer: Arc<dyn BlobWriterCallback>,
+    ) -> Result<(), IrohError> {
+        let chunk_size = match chunk_size {
+            0 => 1024 * 64,
+            n => n as usize,
+        };
+        block_on(&self.rt(), async {
+            use tokio::io::AsyncReadExt;
+
+            let mut reader = self.sync_client.blobs().read(hash.0).await?;
+            let mut buf = vec![0u8; chunk_size];
+            loop {
+                let mut filled = 0;
+                while filled < chunk_size {
+                    let n = reader
+                        .read(&mut buf[filled..])
+                        .await
+                        .map_err(anyhow::Error::from)?;
+                    if n == 0 {
+                        break;
+                    }
+                    filled += n;
+                }
+                if filled == 0 {
+                    break;
+                }
+                writer.write(buf[..filled].to_vec())?;
+                if filled < chunk_size {
+                    break;
+                }
+            }
+            Ok(())
+        })
+    }
+
     /// Export the blob contents to a file path
     /// The `path` field is expected to be the absolute path.
     pub fn blobs_write_to_path(&self, hash: Arc<Hash>, path: String) -> Result<(), IrohError> {
@@ -145,14 +537,174 @@ impl IrohNode {
         })
     }
 
+    /// Write a blob by passing bytes.
+    ///
+    /// Async variant of [`Self::blobs_add_bytes`]: surfaces as a pollable future over the FFI
+    /// instead of blocking the calling thread, and can be cancelled via the rust-future
+    /// cancellation hooks.
+    pub async fn blobs_add_bytes_async(&self, bytes: Vec<u8>) -> Result<BlobAddOutcome, IrohError> {
+        let client = self.sync_client.clone();
+        spawn_on(&self.rt(), async move {
+            let res = client.blobs().add_bytes(bytes).await?;
+            Ok(res.into())
+        })
+        .await
+    }
+
+    /// Write a blob by reading directly from caller-owned memory.
+    ///
+    /// Unlike [`Self::blobs_add_bytes`], which copies the payload out of the foreign buffer
+    /// when it is lowered across the FFI, this hashes and ingests straight from the caller's
+    /// pinned buffer at `ptr`. The buffer must stay valid and unchanged until the call
+    /// returns; once it does, the data is durable in the store and the buffer can be
+    /// released. This is the in-memory analogue of the `in_place` flag on
+    /// [`Self::blobs_add_from_path`].
+    ///
+    /// On an in-memory node the payload is copied after all: the mem store keeps the
+    /// ingested bytes as the blob's backing storage, which must not alias caller memory
+    /// once the call returns. There is deliberately no async variant — cancelling the
+    /// future would detach the caller while ingest still reads the buffer, turning the
+    /// "returned means released" contract into a use-after-free.
+    pub fn blobs_add_from_ptr(&self, ptr: u64, len: u64) -> Result<BlobAddOutcome, IrohError> {
+        let bytes = Self::foreign_bytes(ptr, len)?;
+        let bytes = if self.is_memory() {
+            bytes::Bytes::copy_from_slice(&bytes)
+        } else {
+            bytes
+        };
+        block_on(&self.rt(), async {
+            let res = self.sync_client.blobs().add_bytes(bytes).await?;
+            Ok(res.into())
+        })
+    }
+
+    /// Wrap caller-owned memory in a `Bytes` without copying.
+    ///
+    /// Safety contract (documented on the callers): the memory must stay valid until the
+    /// ingest that consumes it has completed.
+    fn foreign_bytes(ptr: u64, len: u64) -> Result<bytes::Bytes, IrohError> {
+        let len = usize::try_from(len).map_err(anyhow::Error::from)?;
+        if len == 0 {
+            return Ok(bytes::Bytes::new());
+        }
+        let slice: &'static [u8] = unsafe { std::slice::from_raw_parts(ptr as *const u8, len) };
+        Ok(bytes::Bytes::from_static(slice))
+    }
+
     /// Download a blob from another node and add it to the local database.
     pub fn blobs_download(
         &self,
         hash: Arc<Hash>,
         opts: Arc<BlobDownloadOptions>,
         cb: Arc<dyn DownloadCallback>,
+    ) -> Result<(), IrohError> {
+        let start = std::time::Instant::now();
+        let res = block_on(&self.rt(), async {
+            let mut stream = self
+                .sync_client
+                .blobs()
+                .download_with_opts(hash.0, opts.0.clone())
+                .await?;
+            while let Some(progress) = stream.next().await {
+                let progress = progress?;
+                cb.progress(Arc::new(progress.into()))?;
+            }
+            Ok(())
+        });
+        crate::node::ffi_histogram(&crate::FfiMetric::BlobsDownload).record(start.elapsed());
+        res
+    }
+
+    /// Download a blob from another node, with throttled progress reporting.
+    ///
+    /// Behaves like [`Self::blobs_download`], but `Progress` events are coalesced: one is
+    /// only forwarded once `min_interval_millis` has passed since the last forwarded one
+    /// and at least `min_bytes_delta` bytes accumulated. Either threshold can be 0 to
+    /// disable it, so `min_bytes_delta = 0` gives a pure per-interval rate limit. All
+    /// other events (`Found`, `Done`, `AllDone`, `Abort`, ...) are always delivered, so the
+    /// final state is exact while bulk transfers cost a bounded number of callback crossings.
+    pub fn blobs_download_throttled(
+        &self,
+        hash: Arc<Hash>,
+        opts: Arc<BlobDownloadOptions>,
+        cb: Arc<dyn DownloadCallback>,
+        min_bytes_delta: u64,
+        min_interval_millis: u64,
     ) -> Result<(), IrohError> {
         block_on(&self.rt(), async {
+            let mut stream = self
+                .sync_client
+                .blobs()
+                .download_with_opts(hash.0, opts.0.clone())
+                .await?;
+            let mut throttle = ProgressThrottle::new(min_bytes_delta, min_interval_millis);
+            while let Some(progress) = stream.next().await {
+                let progress: DownloadProgress = progress?.into();
+                if let DownloadProgress::Progress(ref p) = progress {
+                    if !throttle.admit(p.id, p.offset) {
+                        continue;
+                    }
+                }
+                cb.progress(Arc::new(progress))?;
+            }
+            Ok(())
+        })
+    }
+
+    /// Download a blob from another node and add it to the local database.
+    ///
+    /// Async variant of [`Self::blobs_download`]: surfaces as a pollable future over the FFI
+    /// instead of blocking the calling thread for the duration of the transfer. Cancelling the
+    /// future via the rust-future cancellation hooks aborts the download.
+    pub async fn blobs_download_async(
+        &self,
+        hash: Arc<Hash>,
+        opts: Arc<BlobDownloadOptions>,
+        cb: Arc<dyn DownloadCallback>,
+    ) -> Result<(), IrohError> {
+        let client = self.sync_client.clone();
+        let opts = opts.0.clone();
+        spawn_on(&self.rt(), async move {
+            let mut stream = client.blobs().download_with_opts(hash.0, opts).await?;
+            while let Some(progress) = stream.next().await {
+                let progress = progress?;
+                cb.progress(Arc::new(progress.into()))?;
+            }
+            Ok(())
+        })
+        .await
+    }
+
+    /// Resume the download of a partial (incomplete) blob.
+    ///
+    /// Errors if there is no partial state for `hash` — use [`Self::blobs_download`] for a
+    /// fresh download. The transfer picks up from the existing verified ranges and only
+    /// fetches what is missing, reporting through the same `DownloadCallback` events as
+    /// [`Self::blobs_download`]. Use [`Self::blobs_list_incomplete`] to find resumable blobs
+    /// and their completion ratio (`size` vs `expected_size`).
+    pub fn blobs_resume(
+        &self,
+        hash: Arc<Hash>,
+        opts: Arc<BlobDownloadOptions>,
+        cb: Arc<dyn DownloadCallback>,
+    ) -> Result<(), IrohError> {
+        block_on(&self.rt(), async {
+            let mut incomplete = self.sync_client.blobs().list_incomplete().await?;
+            let mut found = false;
+            while let Some(info) = incomplete.next().await {
+                if info?.hash == hash.0 {
+                    found = true;
+                    break;
+                }
+            }
+            if !found {
+                return Err(anyhow::anyhow!(
+                    "no partial state for hash {}: nothing to resume",
+                    hash.0
+                )
+                .into());
+            }
+
             let mut stream = self
                 .sync_client
                 .blobs()
@@ -202,6 +754,57 @@ impl IrohNode {
         })
     }
 
+    /// Export a blob to `destination` by sharing storage instead of copying bytes.
+    ///
+    /// Tries, in order: a copy-on-write reflink clone, a hard link, and finally a plain
+    /// copy (e.g. when `destination` is on a different filesystem), and reports which mode
+    /// was used. The first two complete in constant time and add no disk usage, but the
+    /// exported file shares storage with the store — treat it as read-only.
+    ///
+    /// Only raw blobs can be exported this way; use [`Self::blobs_export`] with
+    /// [`BlobExportFormat::Collection`] for collections.
+    pub fn blobs_export_linked(
+        &self,
+        hash: Arc<Hash>,
+        destination: String,
+    ) -> Result<BlobExportLinkMode, IrohError> {
+        let source = block_on(&self.rt(), async {
+            let mut blobs = self.sync_client.blobs().list().await?;
+            while let Some(info) = blobs.next().await {
+                let info = info?;
+                if info.hash == hash.0 {
+                    return Ok(PathBuf::from(info.path));
+                }
+            }
+            Err(IrohError::from(anyhow::anyhow!(
+                "no complete blob found for hash {}",
+                hash.0
+            )))
+        })?;
+
+        let destination = PathBuf::from(destination);
+        if let Some(dir) = destination.parent() {
+            std::fs::create_dir_all(dir).map_err(anyhow::Error::from)?;
+        }
+        if destination.exists() {
+            return Err(anyhow::anyhow!(
+                "destination {} already exists",
+                destination.display()
+            )
+            .into());
+        }
+
+        #[cfg(target_os = "linux")]
+        if try_reflink(&source, &destination).is_ok() {
+            return Ok(BlobExportLinkMode::Reflink);
+        }
+        if std::fs::hard_link(&source, &destination).is_ok() {
+            return Ok(BlobExportLinkMode::HardLink);
+        }
+        std::fs::copy(&source, &destination).map_err(anyhow::Error::from)?;
+        Ok(BlobExportLinkMode::Copy)
+    }
+
     /// Create a ticket for sharing a blob from this node.
     pub fn blobs_share(
         &self,
@@ -254,6 +857,62 @@ impl IrohNode {
         })
     }
 
+    /// List all complete blobs, delivering the hashes in bounded batches.
+    ///
+    /// The `batch` method of `cb` is called with at most `batch_size` hashes at a time while
+    /// the store iterates, so peak memory stays constant regardless of store size. Returning
+    /// an error from the callback stops the listing.
+    pub fn blobs_list_batched(
+        &self,
+        batch_size: u32,
+        cb: Arc<dyn HashBatchCallback>,
+    ) -> Result<(), IrohError> {
+        let batch_size = batch_size.max(1) as usize;
+        block_on(&self.rt(), async {
+            let mut response = self.sync_client.blobs().list().await?;
+
+            let mut batch = Vec::with_capacity(batch_size);
+            while let Some(info) = response.next().await {
+                batch.push(Arc::new(Hash(info?.hash)));
+                if batch.len() == batch_size {
+                    cb.batch(std::mem::replace(&mut batch, Vec::with_capacity(batch_size)))?;
+                }
+            }
+            if !batch.is_empty() {
+                cb.batch(batch)?;
+            }
+            Ok(())
+        })
+    }
+
+    /// List all collections, delivering the infos in bounded batches.
+    ///
+    /// The `batch` method of `cb` is called with at most `batch_size` `CollectionInfo`s at a
+    /// time while the store iterates, so peak memory stays constant regardless of store size.
+    /// Returning an error from the callback stops the listing.
+    pub fn blobs_list_collections_batched(
+        &self,
+        batch_size: u32,
+        cb: Arc<dyn CollectionBatchCallback>,
+    ) -> Result<(), IrohError> {
+        let batch_size = batch_size.max(1) as usize;
+        block_on(&self.rt(), async {
+            let mut response = self.sync_client.blobs().list_collections()?;
+
+            let mut batch = Vec::with_capacity(batch_size);
+            while let Some(info) = response.next().await {
+                batch.push(info?.into());
+                if batch.len() == batch_size {
+                    cb.batch(std::mem::replace(&mut batch, Vec::with_capacity(batch_size)))?;
+                }
+            }
+            if !batch.is_empty() {
+                cb.batch(batch)?;
+            }
+            Ok(())
+        })
+    }
+
     /// Read the content of a collection
     pub fn blobs_get_collection(&self, hash: Arc<Hash>) -> Result<Arc<Collection>, IrohError> {
         block_on(&self.rt(), async {
@@ -295,6 +954,46 @@ impl IrohNode {
         })
     }
 
+    /// Open a chunked read stream over a blob.
+    ///
+    /// The returned [`BlobReadStream`] writes each chunk directly into a caller-provided
+    /// buffer via `read_into`, so a large blob can be streamed with a single reusable
+    /// allocation on the foreign side instead of a fresh buffer per
+    /// [`Self::blobs_read_at_to_bytes`] call.
+    pub fn blobs_read_stream(&self, hash: Arc<Hash>) -> Result<Arc<BlobReadStream>, IrohError> {
+        block_on(&self.rt(), async {
+            let reader = self.sync_client.blobs().read(hash.0).await?;
+            Ok(Arc::new(BlobReadStream {
+                reader: std::sync::Mutex::new(reader),
+                rt: self.rt().clone(),
+            }))
+        })
+    }
+
+    /// Open a zero-copy, memory-mapped view of a complete blob in the store.
+    ///
+    /// The returned [`BlobReader`] maps the verified on-disk blob and exposes a stable
+    /// `(pointer, length)` view that stays valid for the lifetime of the handle, so callers
+    /// can read (`sendfile`, scatter-gather, ...) straight out of the store without the full
+    /// copy that [`Self::blobs_read_to_bytes`] pays.
+    pub fn blobs_reader(&self, hash: Arc<Hash>) -> Result<Arc<BlobReader>, IrohError> {
+        let path = block_on(&self.rt(), async {
+            let mut blobs = self.sync_client.blobs().list().await?;
+            while let Some(info) = blobs.next().await {
+                let info = info?;
+                if info.hash == hash.0 {
+                    return Ok(info.path);
+                }
+            }
+            Err(IrohError::from(anyhow::anyhow!(
+                "no complete blob found for hash {}",
+                hash.0
+            )))
+        })?;
+
+        Ok(Arc::new(BlobReader::open(path.as_ref())?))
+    }
+
     /// Delete a blob.
     pub fn blobs_delete_blob(&self, hash: Arc<Hash>) -> Result<(), IrohError> {
         block_on(&self.rt(), async {
@@ -321,6 +1020,221 @@ impl IrohNode {
     }
 }
 
+/// How [`IrohNode::blobs_export_linked`] ended up materializing the file.
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
+pub enum BlobExportLinkMode {
+    /// A copy-on-write clone of the blob's extents (no extra disk usage).
+    Reflink,
+    /// A hard link to the blob file in the store (no extra disk usage).
+    HardLink,
+    /// A plain copy; sharing storage was not possible.
+    Copy,
+}
+
+/// Clone `source` into `destination` with a copy-on-write reflink (`FICLONE`).
+///
+/// Leaves no file behind on failure so the caller can fall back to other modes.
+#[cfg(target_os = "linux")]
+fn try_reflink(source: &std::path::Path, destination: &std::path::Path) -> std::io::Result<()> {
+    use std::os::unix::io::AsRawFd;
+
+    let src = std::fs::File::open(source)?;
+    let dst = std::fs::File::create(destination)?;
+    let res = unsafe { libc::ioctl(dst.as_raw_fd(), libc::FICLONE, src.as_raw_fd()) };
+    if res != 0 {
+        let err = std::io::Error::last_os_error();
+        drop(dst);
+        let _ = std::fs::remove_file(destination);
+        return Err(err);
+    }
+    Ok(())
+}
+
+/// Recursively collect the files under `dir`, named by their path relative to `root`.
+fn collect_files(
+    root: &std::path::Path,
+    dir: &std::path::Path,
+    files: &mut Vec<(String, PathBuf)>,
+) -> Result<(), IrohError> {
+    for entry in std::fs::read_dir(dir).map_err(anyhow::Error::from)? {
+        let entry = entry.map_err(anyhow::Error::from)?;
+        let path = entry.path();
+        if path.is_dir() {
+            collect_files(root, &path, files)?;
+        } else if path.is_file() {
+            let name = path
+                .strip_prefix(root)
+                .map_err(anyhow::Error::from)?
+                .to_string_lossy()
+                .replace('\\', "/");
+            files.push((name, path));
+        }
+    }
+    Ok(())
+}
+
+/// A chunked read stream over a blob.
+///
+/// Created with `IrohNode::blobs_read_stream`. Each `read_into` call writes the next chunk
+/// of the blob directly into a buffer owned by the caller, so the same buffer can be reused
+/// for the whole transfer.
+pub struct BlobReadStream {
+    reader: std::sync::Mutex<iroh::client::blobs::Reader>,
+    rt: tokio::runtime::Handle,
+}
+
+impl BlobReadStream {
+    /// Read the next chunk of the blob into the caller-provided buffer.
+    ///
+    /// `ptr` is the address of a writable buffer of at least `capacity` bytes, which must
+    /// stay valid for the duration of the call. Returns the number of bytes written; a
+    /// return of 0 means the end of the blob was reached.
+    pub fn read_into(&self, ptr: u64, capacity: u64) -> Result<u64, IrohError> {
+        let capacity = usize::try_from(capacity).map_err(anyhow::Error::from)?;
+        let buf = unsafe { std::slice::from_raw_parts_mut(ptr as *mut u8, capacity) };
+        let mut reader = self.reader.lock().unwrap();
+        block_on(&self.rt, async {
+            use tokio::io::AsyncReadExt;
+
+            let mut filled = 0;
+            while filled < capacity {
+                let n = reader
+                    .read(&mut buf[filled..])
+                    .await
+                    .map_err(anyhow::Error::from)?;
+                if n == 0 {
+                    break;
+                }
+                filled += n;
+            }
+            Ok(filled as u64)
+        })
+    }
+}
+
+/// A zero-copy, memory-mapped view of a complete blob in the store.
+///
+/// Created with `IrohNode::blobs_reader`. The exposed pointer stays valid until the handle
+/// is dropped; the caller must not read past `len` and must not hold on to the pointer after
+/// releasing the handle.
+///
+/// On platforms without `mmap` the blob is read into an owned buffer instead: the surface
+/// and pointer contract are identical, but opening pays a full copy of the blob.
+#[derive(Debug)]
+pub struct BlobReader {
+    #[cfg(unix)]
+    ptr: *mut libc::c_void,
+    #[cfg(not(unix))]
+    buf: Vec<u8>,
+    len: usize,
+}
+
+// Safety: the mapping is read-only and owned by this struct for its whole lifetime.
+#[cfg(unix)]
+unsafe impl Send for BlobReader {}
+#[cfg(unix)]
+unsafe impl Sync for BlobReader {}
+
+impl BlobReader {
+    #[cfg(unix)]
+    pub(crate) fn open(path: &std::path::Path) -> Result<Self, IrohError> {
+        use std::os::unix::io::AsRawFd;
+
+        let file = std::fs::File::open(path).map_err(anyhow::Error::from)?;
+        let len = file.metadata().map_err(anyhow::Error::from)?.len() as usize;
+        if len == 0 {
+            return Ok(BlobReader {
+                ptr: std::ptr::null_mut(),
+                len: 0,
+            });
+        }
+        let ptr = unsafe {
+            libc::mmap(
+                std::ptr::null_mut(),
+                len,
+                libc::PROT_READ,
+                libc::MAP_SHARED,
+                file.as_raw_fd(),
+                0,
+            )
+        };
+        if ptr == libc::MAP_FAILED {
+            return Err(anyhow::anyhow!(
+                "failed to mmap blob at {}: {}",
+                path.display(),
+                std::io::Error::last_os_error()
+            )
+            .into());
+        }
+        Ok(BlobReader { ptr, len })
+    }
+
+    #[cfg(not(unix))]
+    pub(crate) fn open(path: &std::path::Path) -> Result<Self, IrohError> {
+        let buf = std::fs::read(path).map_err(anyhow::Error::from)?;
+        let len = buf.len();
+        Ok(BlobReader { buf, len })
+    }
+
+    /// The length of the blob in bytes.
+    pub fn len(&self) -> u64 {
+        self.len as u64
+    }
+
+    /// Check if the blob is empty.
+    pub fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+
+    /// The address of the first byte of the blob, as an integer.
+    ///
+    /// Returns 0 for an empty blob. The address is only valid while this handle is alive.
+    pub fn ptr(&self) -> u64 {
+        #[cfg(unix)]
+        {
+            self.ptr as u64
+        }
+        #[cfg(not(unix))]
+        {
+            if self.len == 0 {
+                0
+            } else {
+                self.buf.as_ptr() as u64
+            }
+        }
+    }
+
+    /// The address of the byte at `offset`, for a range of `len` bytes.
+    ///
+    /// Errors if `offset + len` reaches past the end of the blob.
+    pub fn range_ptr(&self, offset: u64, len: u64) -> Result<u64, IrohError> {
+        let end = offset.checked_add(len).ok_or_else(|| {
+            IrohError::from(anyhow::anyhow!("range overflows: {} + {}", offset, len))
+        })?;
+        if end > self.len as u64 {
+            return Err(anyhow::anyhow!(
+                "range {}..{} out of bounds for blob of length {}",
+                offset,
+                end,
+                self.len
+            )
+            .into());
+        }
+        Ok(self.ptr() + offset)
+    }
+}
+
+#[cfg(unix)]
+impl Drop for BlobReader {
+    fn drop(&mut self) {
+        if !self.ptr.is_null() {
+            unsafe {
+                libc::munmap(self.ptr, self.len);
+            }
+        }
+    }
+}
+
 /// The Hash and associated tag of a newly created collection
 #[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct HashAndTag {
@@ -477,6 +1391,91 @@ impl From<Hash> for iroh::blobs::Hash {
     }
 }
 
+/// Whether a blob is fully present, partially present, or absent from the store.
+#[derive(Debug, PartialEq, Eq, Serialize, Deserialize, Clone)]
+pub enum BlobStatus {
+    /// The blob is fully present and verified.
+    Complete,
+    /// Some verified ranges of the blob are present.
+    Partial,
+    /// Nothing of the blob is present.
+    Missing,
+}
+
+/// Size and completeness of a single blob, as returned by `IrohNode::blobs_status_batch`.
+#[derive(Debug, Clone)]
+pub struct BlobStatusInfo {
+    /// The queried hash.
+    pub hash: Arc<Hash>,
+    /// Whether the blob is complete, partial or missing.
+    pub status: BlobStatus,
+    /// The size of the blob in bytes; for partial blobs the currently present size, for
+    /// missing blobs 0.
+    pub size: u64,
+}
+
+/// Decides which `Progress` events the `_throttled` transfer variants forward.
+///
+/// Tracks the last seen offset per entry id so that interleaved transfers of several entries
+/// accumulate bytes correctly. Both thresholds are floors: an event is forwarded only once
+/// the interval since the last forwarded event has elapsed and the accumulated byte delta
+/// has been reached, so a zero `min_bytes_delta` gives pure interval (rate-limit)
+/// throttling and a zero interval gives pure byte-delta throttling.
+struct ProgressThrottle {
+    min_bytes_delta: u64,
+    min_interval: Duration,
+    offsets: std::collections::HashMap<u64, u64>,
+    pending_bytes: u64,
+    last_delivery: std::time::Instant,
+}
+
+impl ProgressThrottle {
+    fn new(min_bytes_delta: u64, min_interval_millis: u64) -> Self {
+        ProgressThrottle {
+            min_bytes_delta,
+            min_interval: Duration::from_millis(min_interval_millis),
+            offsets: std::collections::HashMap::new(),
+            pending_bytes: 0,
+            last_delivery: std::time::Instant::now(),
+        }
+    }
+
+    fn admit(&mut self, id: u64, offset: u64) -> bool {
+        let last = self.offsets.insert(id, offset).unwrap_or(0);
+        self.pending_bytes += offset.saturating_sub(last);
+
+        let now = std::time::Instant::now();
+        // the interval is a rate limit: never forward more often than once per interval
+        if now.duration_since(self.last_delivery) < self.min_interval {
+            return false;
+        }
+        if self.pending_bytes < self.min_bytes_delta {
+            return false;
+        }
+        self.pending_bytes = 0;
+        self.last_delivery = now;
+        true
+    }
+}
+
+/// The `write` method will be called with each verified, in-order chunk of blob content
+/// during a `node.blobs_write_to_callback` call. Returning an error aborts the transfer.
+pub trait BlobWriterCallback: Send + Sync + 'static {
+    fn write(&self, chunk: Vec<u8>) -> Result<(), CallbackError>;
+}
+
+/// The `batch` method will be called for each batch of hashes yielded by a
+/// `node.blobs_list_batched` call.
+pub trait HashBatchCallback: Send + Sync + 'static {
+    fn batch(&self, hashes: Vec<Arc<Hash>>) -> Result<(), CallbackError>;
+}
+
+/// The `batch` method will be called for each batch of `CollectionInfo`s yielded by a
+/// `node.blobs_list_collections_batched` call.
+pub trait CollectionBatchCallback: Send + Sync + 'static {
+    fn batch(&self, collections: Vec<CollectionInfo>) -> Result<(), CallbackError>;
+}
+
 /// The `progress` method will be called for each `AddProgress` event that is
 /// emitted during a `node.blobs_add_from_path`. Use the `AddProgress.type()`
 /// method to check the `AddProgressType`
@@ -691,6 +1690,33 @@ impl BlobDownloadOptions {
     }
 }
 
+impl BlobDownloadOptions {
+    /// Create a BlobDownloadRequest that fetches from multiple providers.
+    ///
+    /// The download is handed to the node's download queue, which spreads requests for
+    /// verified ranges over all given providers and falls over to the remaining ones when a
+    /// peer is slow or fails, instead of being limited to a single peer's throughput like
+    /// [`Self::new`].
+    pub fn with_providers(
+        format: BlobFormat,
+        nodes: Vec<Arc<NodeAddr>>,
+        tag: Arc<SetTagOption>,
+    ) -> Result<Self, IrohError> {
+        if nodes.is_empty() {
+            return Err(anyhow::anyhow!("at least one provider is required").into());
+        }
+        Ok(BlobDownloadOptions(iroh::client::blobs::DownloadOptions {
+            format: format.into(),
+            nodes: nodes
+                .into_iter()
+                .map(|node| (*node).clone().try_into())
+                .collect::<Result<Vec<_>, IrohError>>()?,
+            tag: (*tag).clone().into(),
+            mode: iroh::client::blobs::DownloadMode::Queued,
+        }))
+    }
+}
+
 impl From<iroh::client::blobs::DownloadOptions> for BlobDownloadOptions {
     fn from(value: iroh::client::blobs::DownloadOptions) -> Self {
         BlobDownloadOptions(value)
@@ -1141,6 +2167,16 @@ impl Collection {
         Ok(())
     }
 
+    /// Add the given blob to the collection
+    ///
+    /// Raw-hash variant of [`Self::push`]: takes the 32-byte hash by value instead of a
+    /// `Hash` object handle.
+    pub fn push_raw(&self, name: String, hash: Vec<u8>) -> Result<(), IrohError> {
+        let hash = Hash::from_bytes(hash)?;
+        self.0.write().unwrap().push(name, hash.0);
+        Ok(())
+    }
+
     /// Check if the collection is empty
     pub fn is_empty(&self) -> Result<bool, IrohError> {
         Ok(self.0.read().unwrap().is_empty())
@@ -1452,6 +2488,176 @@ mod tests {
         println!("finished");
     }
 
+    #[test]
+    fn test_blobs_list_batched() {
+        let iroh_dir = tempfile::tempdir().unwrap();
+        let node = IrohNode::new(iroh_dir.into_path().display().to_string()).unwrap();
+
+        let num_blobs = 5;
+        let mut hashes = vec![];
+        for i in 0..num_blobs {
+            let mut bytes = vec![i as u8; 100];
+            rand::thread_rng().fill_bytes(&mut bytes);
+            let output = node.blobs_add_bytes(bytes).unwrap();
+            hashes.push(output.hash);
+        }
+
+        struct Callback {
+            batches: Arc<Mutex<Vec<Vec<Arc<Hash>>>>>,
+        }
+
+        impl HashBatchCallback for Callback {
+            fn batch(&self, hashes: Vec<Arc<Hash>>) -> Result<(), CallbackError> {
+                self.batches.lock().unwrap().push(hashes);
+                Ok(())
+            }
+        }
+
+        let batches = Arc::new(Mutex::new(Vec::new()));
+        let cb = Callback {
+            batches: batches.clone(),
+        };
+        node.blobs_list_batched(2, Arc::new(cb)).unwrap();
+
+        let batches = batches.lock().unwrap();
+        let got: Vec<Arc<Hash>> = batches.iter().flatten().cloned().collect();
+        assert_eq!(got.len(), num_blobs);
+        for batch in batches.iter() {
+            assert!(batch.len() <= 2);
+        }
+        hashes_exist(&hashes, &got);
+    }
+
+    #[test]
+    fn test_blobs_write_to_callback() {
+        let iroh_dir = tempfile::tempdir().unwrap();
+        let node = IrohNode::new(iroh_dir.into_path().display().to_string()).unwrap();
+
+        let mut bytes = vec![0; 100];
+        rand::thread_rng().fill_bytes(&mut bytes);
+        let output = node.blobs_add_bytes(bytes.clone()).unwrap();
+
+        struct Writer {
+            got: Arc<Mutex<Vec<u8>>>,
+        }
+
+        impl BlobWriterCallback for Writer {
+            fn write(&self, chunk: Vec<u8>) -> Result<(), CallbackError> {
+                assert!(chunk.len() <= 32);
+                self.got.lock().unwrap().extend_from_slice(&chunk);
+                Ok(())
+            }
+        }
+
+        let got = Arc::new(Mutex::new(Vec::new()));
+        let writer = Writer { got: got.clone() };
+        node.blobs_write_to_callback(output.hash, 32, Arc::new(writer))
+            .unwrap();
+
+        assert_eq!(bytes, *got.lock().unwrap());
+    }
+
+    #[test]
+    fn test_blobs_import_directory() {
+        let iroh_dir = tempfile::tempdir().unwrap();
+        let node = IrohNode::new(iroh_dir.into_path().display().to_string()).unwrap();
+
+        // build a small tree: two files at the root, one in a nested subdir
+        let dir = tempfile::tempdir().unwrap();
+        std::fs::create_dir_all(dir.path().join("sub")).unwrap();
+        let mut contents = std::collections::HashMap::new();
+        for name in ["a", "b", "sub/c"] {
+            let mut bytes = vec![0; 100];
+            rand::thread_rng().fill_bytes(&mut bytes);
+            std::fs::write(dir.path().join(name), &bytes).unwrap();
+            contents.insert(name.to_string(), bytes);
+        }
+
+        struct Callback {
+            events: Arc<Mutex<Vec<Arc<AddProgress>>>>,
+        }
+        impl AddCallback for Callback {
+            fn progress(&self, progress: Arc<AddProgress>) -> Result<(), CallbackError> {
+                self.events.lock().unwrap().push(progress);
+                Ok(())
+            }
+        }
+        let events = Arc::new(Mutex::new(Vec::new()));
+        let cb = Callback {
+            events: events.clone(),
+        };
+
+        let outcome = node
+            .blobs_import_directory(
+                dir.path().display().to_string(),
+                4,
+                Arc::new(SetTagOption::auto()),
+                Arc::new(cb),
+            )
+            .unwrap();
+
+        // the collection lists the files under their relative names, in sorted order,
+        // regardless of the order the parallel imports finished in
+        let collection = node.blobs_get_collection(outcome.hash.clone()).unwrap();
+        let names = collection.names().unwrap();
+        assert_eq!(
+            vec!["a".to_string(), "b".to_string(), "sub/c".to_string()],
+            names
+        );
+        for (name, hash) in names.iter().zip(collection.links().unwrap()) {
+            let got = node.blobs_read_to_bytes(hash).unwrap();
+            assert_eq!(contents[name], got);
+        }
+
+        // one Found and one Done per file, one final AllDone with the collection hash
+        let events = events.lock().unwrap();
+        let found = events
+            .iter()
+            .filter(|e| matches!(***e, AddProgress::Found(_)))
+            .count();
+        let done = events
+            .iter()
+            .filter(|e| matches!(***e, AddProgress::Done(_)))
+            .count();
+        assert_eq!(3, found);
+        assert_eq!(3, done);
+        match **events.last().unwrap() {
+            AddProgress::AllDone(ref d) => assert!(d.hash.equal(&outcome.hash)),
+            _ => panic!("expected the final event to be AllDone"),
+        }
+
+        // the per-file auto tags were released; only the collection tag remains
+        let tags = node.tags_list().unwrap();
+        assert_eq!(1, tags.len());
+        assert_eq!(outcome.tag, tags[0].name);
+    }
+
+    #[test]
+    fn test_blobs_export_linked() {
+        let iroh_dir = tempfile::tempdir().unwrap();
+        let node = IrohNode::new(iroh_dir.into_path().display().to_string()).unwrap();
+
+        let mut bytes = vec![0; 100];
+        rand::thread_rng().fill_bytes(&mut bytes);
+        let outcome = node.blobs_add_bytes(bytes.clone()).unwrap();
+
+        // whichever of reflink/hardlink/copy the filesystem supports, the exported
+        // file must hold the blob's content
+        let dir = tempfile::tempdir().unwrap();
+        let destination = dir.path().join("sub").join("exported");
+        let mode = node
+            .blobs_export_linked(outcome.hash.clone(), destination.display().to_string())
+            .unwrap();
+        println!("export mode: {:?}", mode);
+        let got = std::fs::read(&destination).unwrap();
+        assert_eq!(bytes, got);
+
+        // a second export to the same destination must refuse to clobber it
+        assert!(node
+            .blobs_export_linked(outcome.hash, destination.display().to_string())
+            .is_err());
+    }
+
     fn hashes_exist(expect: &Vec<Arc<Hash>>, got: &[Arc<Hash>]) {
         for hash in expect {
             if !got.contains(hash) {
@@ -1468,6 +2674,7 @@ mod tests {
         // we're going to use a very fast GC interval to get this test to delete stuff aggressively
         let opts = NodeOptions {
             gc_interval_millis: Some(100),
+            ..NodeOptions::default()
         };
         let node =
             IrohNode::with_options(iroh_dir.into_path().display().to_string(), opts).unwrap();
@@ -2,15 +2,15 @@ use std::{path::PathBuf, str::FromStr, sync::Arc, time::SystemTime};
 
 use bytes::Bytes;
 use futures::{StreamExt, TryStreamExt};
-use iroh::client::MemDoc;
+use iroh::client::{MemDoc, MemIroh};
 use serde::{Deserialize, Serialize};
 
 use crate::{
-    block_on, ticket::AddrInfoOptions, AuthorId, CallbackError, Hash, IrohError, IrohNode,
-    PublicKey,
+    block_on, spawn_on, ticket::AddrInfoOptions, AuthorId, CallbackError, Hash, IrohError,
+    IrohNode, PublicKey,
 };
 
-#[derive(Debug)]
+#[derive(Debug, Clone, Serialize, Deserialize)]
 pub enum CapabilityKind {
     /// A writable replica.
     Write = 1,
@@ -30,25 +30,43 @@ impl From<iroh::docs::CapabilityKind> for CapabilityKind {
 impl IrohNode {
     /// Create a new doc.
     pub fn doc_create(&self) -> Result<Arc<Doc>, IrohError> {
-        block_on(&self.rt(), async {
+        let doc = block_on(&self.rt(), async {
             let doc = self.sync_client.docs().create().await?;
 
-            Ok(Arc::new(Doc {
-                inner: doc,
-                rt: self.rt().clone(),
-            }))
-        })
+            Ok(Arc::new(Doc::new(doc, self.rt().clone())))
+        });
+        self.refresh_doc_list_snapshot();
+        doc
     }
 
     /// Join and sync with an already existing document.
     pub fn doc_join(&self, ticket: String) -> Result<Arc<Doc>, IrohError> {
-        block_on(&self.rt(), async {
+        let doc = block_on(&self.rt(), async {
             let ticket = iroh::docs::DocTicket::from_str(&ticket).map_err(anyhow::Error::from)?;
             let doc = self.sync_client.docs().import(ticket).await?;
-            Ok(Arc::new(Doc {
-                inner: doc,
-                rt: self.rt().clone(),
-            }))
+            Ok(Arc::new(Doc::new(doc, self.rt().clone())))
+        });
+        self.refresh_doc_list_snapshot();
+        doc
+    }
+
+    /// Join and sync with an already existing document.
+    ///
+    /// Async variant of [`Self::doc_join`]: surfaces as a pollable future over the FFI instead
+    /// of blocking the calling thread, and can be cancelled via the rust-future cancellation
+    /// hooks.
+    pub async fn doc_join_async(&self, ticket: String) -> Result<Arc<Doc>, IrohError> {
+        let client = self.sync_client.clone();
+        let rt = self.rt().clone();
+        spawn_on(&self.rt(), async move {
+            let ticket = iroh::docs::DocTicket::from_str(&ticket).map_err(anyhow::Error::from)?;
+            let doc = client.docs().import(ticket).await?;
+            Ok(Arc::new(Doc::new(doc, rt)))
+        })
+        .await
+        .map(|doc| {
+            self.refresh_doc_list_snapshot();
+            doc
         })
     }
 
@@ -78,10 +96,8 @@ impl IrohNode {
             }
         });
 
-        Ok(Arc::new(Doc {
-            inner: doc,
-            rt: self.rt().clone(),
-        }))
+        self.refresh_doc_list_snapshot();
+        Ok(Arc::new(Doc::new(doc, self.rt().clone())))
     }
 
     /// List all the docs we have access to on this node.
@@ -111,15 +127,44 @@ impl IrohNode {
         block_on(&self.rt(), async {
             let doc = self.sync_client.docs().open(namespace_id).await?;
 
-            Ok(doc.map(|d| {
-                Arc::new(Doc {
-                    inner: d,
-                    rt: self.rt().clone(),
-                })
-            }))
+            Ok(doc.map(|d| Arc::new(Doc::new(d, self.rt().clone()))))
         })
     }
 
+    /// Get a process-wide shared [`Doc`] handle.
+    ///
+    /// Unlike [`Self::doc_open`], which constructs a fresh handle per call, this returns the
+    /// same handle to every caller opening the same namespace id for as long as at least one
+    /// of them holds it. N openers share one handle (and, via
+    /// [`Doc::subscribe_shared`], one event subscription) instead of paying N sync-engine
+    /// attachments for the same hot doc.
+    ///
+    /// Returns None if the document cannot be found.
+    pub fn doc_open_shared(&self, id: String) -> Result<Option<Arc<Doc>>, IrohError> {
+        if let Some(doc) = self
+            .open_docs
+            .lock()
+            .unwrap()
+            .get(&id)
+            .and_then(|doc| doc.upgrade())
+        {
+            return Ok(Some(doc));
+        }
+
+        let doc = self.doc_open(id.clone())?;
+        Ok(doc.map(|doc| {
+            let mut registry = self.open_docs.lock().unwrap();
+            // another caller may have raced us here; prefer the handle that won
+            match registry.get(&id).and_then(|doc| doc.upgrade()) {
+                Some(existing) => existing,
+                None => {
+                    registry.insert(id, Arc::downgrade(&doc));
+                    doc
+                }
+            }
+        }))
+    }
+
     /// Delete a document from the local node.
     ///
     /// This is a destructive operation. Both the document secret key and all entries in the
@@ -133,11 +178,61 @@ impl IrohNode {
                 .drop_doc(doc_id)
                 .await
                 .map_err(IrohError::from)
-        })
+        })?;
+        self.refresh_doc_list_snapshot();
+        Ok(())
     }
 }
 
+/// A single (author, key, value) triple for [`Doc::set_bytes_batch`].
+#[derive(Debug, Clone)]
+pub struct BatchEntry {
+    /// The author of the entry.
+    pub author: Arc<AuthorId>,
+    /// The key of the entry.
+    pub key: Vec<u8>,
+    /// The content of the entry.
+    pub value: Vec<u8>,
+}
+
+/// How many background-priority docs may run their initial sync concurrently.
+static BACKGROUND_SYNC_PERMITS: tokio::sync::Semaphore = tokio::sync::Semaphore::const_new(2);
+
+/// How long a background sync may hold its permit while waiting for its first
+/// `SyncFinished`. A doc whose peers never answer (e.g. rejoining after downtime) must not
+/// pin the small process-wide budget forever; after this long the permit is released and
+/// the sync keeps running unbudgeted.
+const BACKGROUND_SYNC_PERMIT_TIMEOUT: std::time::Duration =
+    std::time::Duration::from_secs(10 * 60);
+
+/// The scheduling class of a [`Doc::start_sync_with`] call.
+#[derive(Debug, Clone)]
+pub enum SyncPriority {
+    /// Start syncing immediately; for docs a user is waiting on.
+    Interactive,
+    /// Defer behind other background syncs; for archival or bulk re-syncs.
+    Background,
+}
+
+/// Options passed to [`Doc::start_sync_with`].
+#[derive(Debug, Clone)]
+pub struct SyncOptions {
+    /// The scheduling class for this doc's sync.
+    pub priority: SyncPriority,
+}
+
+/// An [`Entry`] plus — for small values — its content, as returned by
+/// [`Doc::get_many_hydrated`].
+#[derive(Debug, Clone)]
+pub struct HydratedEntry {
+    /// The entry.
+    pub entry: Arc<Entry>,
+    /// The content of the entry, if it was smaller than the hydration threshold.
+    pub content: Option<Vec<u8>>,
+}
+
 /// The namespace id and CapabilityKind (read/write) of the doc
+#[derive(Debug, Clone, Serialize, Deserialize)]
 pub struct NamespaceAndCapability {
     /// The namespace id of the doc
     pub namespace: String,
@@ -145,14 +240,69 @@ pub struct NamespaceAndCapability {
     pub capability: CapabilityKind,
 }
 
+/// The file inside a persistent node's data directory that holds the doc-list snapshot.
+pub(crate) const DOC_LIST_SNAPSHOT_FILE: &str = "doc-list.snapshot.json";
+
+/// Write the current doc list to the snapshot file in `data_dir`.
+///
+/// The write goes through a temp file and rename so a crash mid-write never leaves a torn
+/// snapshot for [`cached_doc_list`] to read.
+pub(crate) async fn persist_doc_list_snapshot(
+    client: &MemIroh,
+    data_dir: PathBuf,
+) -> anyhow::Result<()> {
+    let docs = client
+        .docs()
+        .list()
+        .await?
+        .map_ok(|(namespace, capability)| NamespaceAndCapability {
+            namespace: namespace.to_string(),
+            capability: capability.into(),
+        })
+        .try_collect::<Vec<_>>()
+        .await?;
+    let bytes = serde_json::to_vec(&docs)?;
+    let tmp = data_dir.join(format!("{}.tmp", DOC_LIST_SNAPSHOT_FILE));
+    tokio::fs::write(&tmp, bytes).await?;
+    tokio::fs::rename(&tmp, data_dir.join(DOC_LIST_SNAPSHOT_FILE)).await?;
+    Ok(())
+}
+
+/// Read the doc list persisted by a previous session of a node at `path`, without opening
+/// the node.
+///
+/// Opening a large persistent node blocks while the store is loaded and verified. A
+/// persistent node keeps a small snapshot of [`IrohNode::doc_list`] up to date in its data
+/// directory; this reads that snapshot directly, so tooling can show the doc inventory
+/// immediately while the real [`IrohNode::new`] runs on another thread. The snapshot
+/// reflects the doc list as of the previous session; errors if the node has never written
+/// one.
+pub fn cached_doc_list(path: String) -> Result<Vec<NamespaceAndCapability>, IrohError> {
+    let snapshot = PathBuf::from(path).join(DOC_LIST_SNAPSHOT_FILE);
+    let bytes = std::fs::read(snapshot).map_err(anyhow::Error::from)?;
+    let docs = serde_json::from_slice(&bytes).map_err(anyhow::Error::from)?;
+    Ok(docs)
+}
+
 /// A representation of a mutable, synchronizable key-value store.
 #[derive(Clone)]
 pub struct Doc {
     pub(crate) inner: MemDoc,
     pub(crate) rt: tokio::runtime::Handle,
+    /// Callbacks registered via [`Doc::subscribe_shared`], fanned out from a single engine
+    /// subscription.
+    pub(crate) shared_subscribers: Arc<std::sync::Mutex<Vec<Arc<dyn SubscribeCallback>>>>,
 }
 
 impl Doc {
+    pub(crate) fn new(inner: MemDoc, rt: tokio::runtime::Handle) -> Self {
+        Doc {
+            inner,
+            rt,
+            shared_subscribers: Arc::new(std::sync::Mutex::new(Vec::new())),
+        }
+    }
+
     /// Get the document id of this doc.
     pub fn id(&self) -> String {
         self.inner.id().to_string()
@@ -172,9 +322,56 @@ impl Doc {
         key: Vec<u8>,
         value: Vec<u8>,
     ) -> Result<Arc<Hash>, IrohError> {
-        block_on(&self.rt, async {
+        let start = std::time::Instant::now();
+        let res = block_on(&self.rt, async {
             let hash = self.inner.set_bytes(author_id.0, key, value).await?;
             Ok(Arc::new(Hash(hash)))
+        });
+        crate::node::ffi_histogram(&crate::FfiMetric::DocSetBytes).record(start.elapsed());
+        res
+    }
+
+    /// Set the content of a key to a byte array.
+    ///
+    /// Async variant of [`Self::set_bytes`]: surfaces as a pollable future over the FFI instead
+    /// of blocking the calling thread, and can be cancelled via the rust-future cancellation
+    /// hooks.
+    pub async fn set_bytes_async(
+        &self,
+        author_id: &AuthorId,
+        key: Vec<u8>,
+        value: Vec<u8>,
+    ) -> Result<Arc<Hash>, IrohError> {
+        let doc = self.inner.clone();
+        let author = author_id.0;
+        spawn_on(&self.rt, async move {
+            let hash = doc.set_bytes(author, key, value).await?;
+            Ok(Arc::new(Hash(hash)))
+        })
+        .await
+    }
+
+    /// Set the content of many keys in a single call.
+    ///
+    /// The whole batch crosses the FFI once and the inserts are issued to the sync engine
+    /// concurrently, so inserting many small entries is much cheaper than calling
+    /// [`Self::set_bytes`] per entry. Returns the content hashes in the same order as the
+    /// given entries.
+    pub fn set_bytes_batch(&self, entries: Vec<BatchEntry>) -> Result<Vec<Arc<Hash>>, IrohError> {
+        block_on(&self.rt, async {
+            let hashes = futures::stream::iter(entries.into_iter().map(|entry| {
+                let doc = self.inner.clone();
+                async move {
+                    let hash = doc
+                        .set_bytes(entry.author.0, entry.key, entry.value)
+                        .await?;
+                    Ok::<_, IrohError>(Arc::new(Hash(hash)))
+                }
+            }))
+            .buffered(64)
+            .try_collect::<Vec<_>>()
+            .await?;
+            Ok(hashes)
         })
     }
 
@@ -244,6 +441,94 @@ impl Doc {
         })
     }
 
+    /// Export all entries matching a query to a directory, with parallel I/O.
+    ///
+    /// Resolves `query` inside the node, maps each entry key back to a relative path under
+    /// `destination_root` (the inverse of [`crate::path_to_key`], so keys must be
+    /// path-shaped), and exports up to `worker_count` entries concurrently. Progress is
+    /// aggregated: `cb` — if given — is invoked once per finished entry with running totals
+    /// rather than once per transferred chunk. Returns the number of exported entries.
+    ///
+    /// Keys are written by whoever holds write capability on the doc, so a key whose derived
+    /// path does not stay under `destination_root` (absolute, or containing `..`) is treated
+    /// as hostile and fails the export rather than writing outside the root.
+    pub fn export_query(
+        &self,
+        query: Arc<Query>,
+        destination_root: String,
+        worker_count: u32,
+        cb: Option<Arc<dyn ExportQueryCallback>>,
+    ) -> Result<u64, IrohError> {
+        let worker_count = worker_count.max(1) as usize;
+        let root = PathBuf::from(destination_root);
+        block_on(&self.rt, async {
+            let entries: Vec<iroh::client::docs::Entry> = self
+                .inner
+                .get_many(query.0.clone())
+                .await?
+                .try_collect()
+                .await?;
+            let total_entries = entries.len() as u64;
+
+            let mut results = futures::stream::iter(entries.into_iter().map(|entry| {
+                let doc = self.inner.clone();
+                let root = root.clone();
+                async move {
+                    let path = iroh::util::fs::key_to_path(
+                        entry.id().key().to_vec(),
+                        None,
+                        Some(root.clone()),
+                    )?;
+                    // keys come from (possibly remote) doc authors: refuse any derived
+                    // path that does not stay strictly under the destination root
+                    let escapes = !path.starts_with(&root)
+                        || path.strip_prefix(&root).unwrap().components().any(|c| {
+                            !matches!(
+                                c,
+                                std::path::Component::Normal(_) | std::path::Component::CurDir
+                            )
+                        });
+                    if escapes {
+                        return Err(anyhow::anyhow!(
+                            "entry key {:?} escapes the destination root {}",
+                            String::from_utf8_lossy(entry.id().key()),
+                            root.display()
+                        )
+                        .into());
+                    }
+                    if let Some(parent) = path.parent() {
+                        tokio::fs::create_dir_all(parent)
+                            .await
+                            .map_err(anyhow::Error::from)?;
+                    }
+                    let mut stream = doc
+                        .export_file(entry.clone(), path, iroh::blobs::store::ExportMode::Copy)
+                        .await?;
+                    while let Some(progress) = stream.next().await {
+                        progress?;
+                    }
+                    Ok::<u64, IrohError>(entry.content_len())
+                }
+            }))
+            .buffer_unordered(worker_count);
+
+            let mut finished_entries = 0;
+            let mut finished_bytes = 0;
+            while let Some(res) = results.next().await {
+                finished_bytes += res?;
+                finished_entries += 1;
+                if let Some(ref cb) = cb {
+                    cb.progress(ExportQueryProgress {
+                        finished_entries,
+                        total_entries,
+                        finished_bytes,
+                    })?;
+                }
+            }
+            Ok(finished_entries)
+        })
+    }
+
     /// Delete entries that match the given `author` and key `prefix`.
     ///
     /// This inserts an empty entry with the key set to `prefix`, effectively clearing all other
@@ -291,6 +576,128 @@ impl Doc {
         })
     }
 
+    /// Get entries.
+    ///
+    /// Async variant of [`Self::get_many`]: surfaces as a pollable future over the FFI instead
+    /// of blocking the calling thread, and can be cancelled via the rust-future cancellation
+    /// hooks.
+    pub async fn get_many_async(&self, query: Arc<Query>) -> Result<Vec<Arc<Entry>>, IrohError> {
+        let doc = self.inner.clone();
+        let query = query.0.clone();
+        spawn_on(&self.rt, async move {
+            let entries = doc
+                .get_many(query)
+                .await?
+                .map_ok(|e| Arc::new(Entry(e)))
+                .try_collect::<Vec<_>>()
+                .await?;
+            Ok(entries)
+        })
+        .await
+    }
+
+    /// Get entries with small content inlined into the results.
+    ///
+    /// Behaves like [`Self::get_many`], but entries whose content is smaller than
+    /// `hydrate_content_below` bytes come back with their value already attached, so reading
+    /// them needs no further [`Entry::content_bytes`] round trip per entry. Larger entries
+    /// have `content` unset and are read the usual way. Content lookups are issued to the
+    /// store concurrently while the batch is assembled.
+    pub fn get_many_hydrated(
+        &self,
+        query: Arc<Query>,
+        hydrate_content_below: u64,
+    ) -> Result<Vec<HydratedEntry>, IrohError> {
+        block_on(&self.rt, async {
+            let entries: Vec<iroh::client::docs::Entry> = self
+                .inner
+                .get_many(query.0.clone())
+                .await?
+                .try_collect()
+                .await?;
+
+            let hydrated = futures::stream::iter(entries.into_iter().map(|entry| {
+                let doc = self.inner.clone();
+                async move {
+                    let content = if entry.content_len() < hydrate_content_below {
+                        Some(entry.content_bytes(&doc).await?.to_vec())
+                    } else {
+                        None
+                    };
+                    Ok::<_, IrohError>(HydratedEntry {
+                        entry: Arc::new(Entry(entry)),
+                        content,
+                    })
+                }
+            }))
+            .buffered(64)
+            .try_collect::<Vec<_>>()
+            .await?;
+            Ok(hydrated)
+        })
+    }
+
+    /// Count the entries matching a query.
+    ///
+    /// The result set is consumed inside the node, so only a single number crosses the FFI
+    /// instead of the serialized metadata of every matching entry.
+    pub fn count(&self, query: Arc<Query>) -> Result<u64, IrohError> {
+        block_on(&self.rt, async {
+            let mut stream = self.inner.get_many(query.0.clone()).await?;
+            let mut count: u64 = 0;
+            while let Some(entry) = stream.next().await {
+                entry?;
+                count += 1;
+            }
+            Ok(count)
+        })
+    }
+
+    /// Total content size, in bytes, of the entries matching a query.
+    ///
+    /// The result set is consumed inside the node, so only a single number crosses the FFI
+    /// instead of the serialized metadata of every matching entry.
+    pub fn size(&self, query: Arc<Query>) -> Result<u64, IrohError> {
+        block_on(&self.rt, async {
+            let mut stream = self.inner.get_many(query.0.clone()).await?;
+            let mut size: u64 = 0;
+            while let Some(entry) = stream.next().await {
+                size += entry?.content_len();
+            }
+            Ok(size)
+        })
+    }
+
+    /// Open a lazy cursor over the results of a query.
+    ///
+    /// Unlike [`Self::get_many`], which materializes an `Entry` handle for the whole result
+    /// set before returning, the cursor pulls results from the store on demand and only
+    /// allocates handles for the page being consumed, so memory stays flat and the first
+    /// page is available as soon as the store yields it.
+    pub fn query_cursor(&self, query: Arc<Query>) -> Result<Arc<QueryCursor>, IrohError> {
+        let (send, recv) = flume::bounded(QueryCursor::CHANNEL_CAP);
+        let doc = self.inner.clone();
+        let query = query.0.clone();
+        self.rt.spawn(async move {
+            let mut stream = match doc.get_many(query).await {
+                Ok(stream) => stream,
+                Err(err) => {
+                    send.send_async(Err(err.into())).await.ok();
+                    return;
+                }
+            };
+            while let Some(entry) = stream.next().await {
+                let entry = entry.map(Entry).map_err(IrohError::from);
+                // the receiver hanging up means the cursor was dropped: stop iterating
+                if send.send_async(entry).await.is_err() {
+                    break;
+                }
+            }
+        });
+
+        Ok(Arc::new(QueryCursor { recv }))
+    }
+
     /// Get the latest entry for a key and author.
     pub fn get_one(&self, query: Arc<Query>) -> Result<Option<Arc<Entry>>, IrohError> {
         block_on(&self.rt, async {
@@ -303,6 +710,24 @@ impl Doc {
         })
     }
 
+    /// Get the latest entry for a key and author.
+    ///
+    /// Async variant of [`Self::get_one`]: surfaces as a pollable future over the FFI instead
+    /// of blocking the calling thread, and can be cancelled via the rust-future cancellation
+    /// hooks.
+    pub async fn get_one_async(&self, query: Arc<Query>) -> Result<Option<Arc<Entry>>, IrohError> {
+        let doc = self.inner.clone();
+        let query = query.0.clone();
+        spawn_on(&self.rt, async move {
+            let res = doc
+                .get_one(query)
+                .await
+                .map(|e| e.map(|e| Arc::new(e.into())))?;
+            Ok(res)
+        })
+        .await
+    }
+
     /// Share this document with peers over a ticket.
     pub fn share(
         &self,
@@ -334,6 +759,73 @@ impl Doc {
         })
     }
 
+    /// Start to sync this document with a list of peers, with scheduling control.
+    ///
+    /// `Interactive` priority behaves exactly like [`Self::start_sync`]. `Background`
+    /// priority returns immediately and defers the actual sync start until a process-wide
+    /// budget of concurrent background initial syncs has room — the permit is held until
+    /// this doc sees its first `SyncFinished` event, or at most
+    /// [`BACKGROUND_SYNC_PERMIT_TIMEOUT`] — so a node rejoining with many archival docs
+    /// trickles them through instead of saturating the uplink while interactive docs stall,
+    /// and docs whose peers never answer cannot pin the budget.
+    pub fn start_sync_with(
+        &self,
+        peers: Vec<Arc<NodeAddr>>,
+        opts: SyncOptions,
+    ) -> Result<(), IrohError> {
+        let peers = peers
+            .into_iter()
+            .map(|p| (*p).clone().try_into())
+            .collect::<Result<Vec<_>, IrohError>>()?;
+
+        match opts.priority {
+            SyncPriority::Interactive => block_on(&self.rt, async {
+                self.inner.start_sync(peers).await?;
+                Ok(())
+            }),
+            SyncPriority::Background => {
+                let doc = self.inner.clone();
+                self.rt.spawn(async move {
+                    let _permit = BACKGROUND_SYNC_PERMITS.acquire().await.expect("not closed");
+                    // subscribe before starting the sync: a sync that finishes quickly
+                    // would otherwise emit its SyncFinished before the subscription
+                    // exists, pinning the permit for the full timeout
+                    let events = match doc.subscribe().await {
+                        Ok(events) => Some(events),
+                        Err(err) => {
+                            println!("rpc error: {:?}", err);
+                            None
+                        }
+                    };
+                    if let Err(err) = doc.start_sync(peers).await {
+                        println!("rpc error: {:?}", err);
+                        return;
+                    }
+                    // hold the permit until the initial sync is done, so only a bounded
+                    // number of background docs fetch content at once — but never longer
+                    // than the timeout, so unreachable peers cannot pin the budget
+                    let Some(mut events) = events else {
+                        return;
+                    };
+                    let wait = async {
+                        while let Some(event) = events.next().await {
+                            match event {
+                                Ok(iroh::client::docs::LiveEvent::SyncFinished(_)) => break,
+                                Ok(_) => {}
+                                Err(err) => {
+                                    println!("rpc error: {:?}", err);
+                                    break;
+                                }
+                            }
+                        }
+                    };
+                    let _ = tokio::time::timeout(BACKGROUND_SYNC_PERMIT_TIMEOUT, wait).await;
+                });
+                Ok(())
+            }
+        }
+    }
+
     /// Stop the live sync for this document.
     pub fn leave(&self) -> Result<(), IrohError> {
         block_on(&self.rt, async {
@@ -364,6 +856,102 @@ impl Doc {
         Ok(())
     }
 
+    /// Subscribe to events for this document, sharing one engine subscription per handle.
+    ///
+    /// All callbacks registered on the same [`Doc`] handle — e.g. one obtained via
+    /// `doc_open_shared` from many worker contexts — are fanned out from a single event
+    /// stream, so N subscribers cost one sync-engine subscription instead of N.
+    pub fn subscribe_shared(&self, cb: Arc<dyn SubscribeCallback>) -> Result<(), IrohError> {
+        let mut subscribers = self.shared_subscribers.lock().unwrap();
+        subscribers.push(cb);
+        if subscribers.len() > 1 {
+            // the fan-out task is already running
+            return Ok(());
+        }
+
+        let client = self.inner.clone();
+        let subscribers = self.shared_subscribers.clone();
+        self.rt.spawn(async move {
+            let mut sub = match client.subscribe().await {
+                Ok(sub) => sub,
+                Err(err) => {
+                    println!("rpc error: {:?}", err);
+                    return;
+                }
+            };
+            while let Some(event) = sub.next().await {
+                match event {
+                    Ok(event) => {
+                        let event: Arc<LiveEvent> = Arc::new(event.into());
+                        let subscribers = subscribers.lock().unwrap().clone();
+                        for cb in subscribers {
+                            if let Err(err) = cb.event(event.clone()) {
+                                println!("cb error: {:?}", err);
+                            }
+                        }
+                    }
+                    Err(err) => {
+                        println!("rpc error: {:?}", err);
+                    }
+                }
+            }
+        });
+
+        Ok(())
+    }
+
+    /// Subscribe to events for this document, delivering them in coalesced batches.
+    ///
+    /// Instead of one callback crossing per `LiveEvent`, events are buffered and the `batch`
+    /// method of `cb` is invoked with up to `max_batch_size` events at once. A batch is
+    /// flushed as soon as it is full or once `max_delay_millis` has passed since its first
+    /// event arrived, whichever comes first — so bulk syncs cost few crossings while a
+    /// trickle of events is still delivered promptly.
+    pub fn subscribe_batched(
+        &self,
+        cb: Arc<dyn SubscribeBatchCallback>,
+        max_batch_size: u32,
+        max_delay_millis: u64,
+    ) -> Result<(), IrohError> {
+        let client = self.inner.clone();
+        let max_batch_size = max_batch_size.max(1) as usize;
+        let max_delay = std::time::Duration::from_millis(max_delay_millis);
+        self.rt.spawn(async move {
+            let mut sub = client.subscribe().await.unwrap();
+            loop {
+                // wait for the first event of the next batch
+                let first = match sub.next().await {
+                    Some(Ok(event)) => Arc::new(event.into()),
+                    Some(Err(err)) => {
+                        println!("rpc error: {:?}", err);
+                        continue;
+                    }
+                    None => break,
+                };
+                let mut batch = Vec::with_capacity(max_batch_size);
+                batch.push(first);
+
+                let deadline = tokio::time::Instant::now() + max_delay;
+                while batch.len() < max_batch_size {
+                    match tokio::time::timeout_at(deadline, sub.next()).await {
+                        Ok(Some(Ok(event))) => batch.push(Arc::new(event.into())),
+                        Ok(Some(Err(err))) => {
+                            println!("rpc error: {:?}", err);
+                        }
+                        // the stream ended or the delay budget is used up: flush what we have
+                        Ok(None) | Err(_) => break,
+                    }
+                }
+
+                if let Err(err) = cb.batch(batch) {
+                    println!("cb error: {:?}", err);
+                }
+            }
+        });
+
+        Ok(())
+    }
+
     /// Get status info for this document
     pub fn status(&self) -> Result<OpenState, IrohError> {
         block_on(&self.rt, async {
@@ -395,6 +983,37 @@ impl Doc {
     }
 }
 
+/// A lazy cursor over the results of a [`Query`].
+///
+/// Created with `Doc::query_cursor`. Entries are pulled from the store on demand, with
+/// backpressure towards the store iteration, so the peak memory use is bounded by the page
+/// size regardless of how large the result set is.
+pub struct QueryCursor {
+    recv: flume::Receiver<Result<Entry, IrohError>>,
+}
+
+impl QueryCursor {
+    /// How many entries the background iteration may run ahead of the consumer.
+    const CHANNEL_CAP: usize = 1024;
+
+    /// Get the next page of results, with at most `page_size` entries.
+    ///
+    /// Returns an empty list once the result set is exhausted.
+    pub fn next_page(&self, page_size: u32) -> Result<Vec<Arc<Entry>>, IrohError> {
+        let page_size = page_size as usize;
+        let mut page = Vec::with_capacity(page_size.min(Self::CHANNEL_CAP));
+        while page.len() < page_size {
+            match self.recv.recv() {
+                Ok(Ok(entry)) => page.push(Arc::new(entry)),
+                Ok(Err(err)) => return Err(err),
+                // the sender hung up: iteration is done
+                Err(_) => break,
+            }
+        }
+        Ok(page)
+    }
+}
+
 /// Download policy to decide which content blobs shall be downloaded.
 #[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub enum DownloadPolicy {
@@ -652,6 +1271,37 @@ impl Entry {
             Ok(res)
         })
     }
+
+    /// Read the content of an [`Entry`] directly into a caller-provided buffer.
+    ///
+    /// Unlike [`Self::content_bytes`], which lowers the content as a fresh byte buffer on
+    /// every call, this writes into the memory at `ptr` (a writable buffer of at least
+    /// `capacity` bytes, valid for the duration of the call) and returns the number of bytes
+    /// written. The caller can reuse one buffer across any number of entries, so steady-state
+    /// small reads cost no per-call allocation at the FFI boundary. Errors if the content
+    /// does not fit in `capacity`.
+    pub fn content_bytes_into(
+        &self,
+        doc: Arc<Doc>,
+        ptr: u64,
+        capacity: u64,
+    ) -> Result<u64, IrohError> {
+        block_on(&doc.rt, async {
+            let res = self.0.content_bytes(&doc.inner).await?;
+            if res.len() as u64 > capacity {
+                return Err(anyhow::anyhow!(
+                    "buffer too small: need {} bytes, capacity is {}",
+                    res.len(),
+                    capacity
+                )
+                .into());
+            }
+            unsafe {
+                std::ptr::copy_nonoverlapping(res.as_ptr(), ptr as *mut u8, res.len());
+            }
+            Ok(res.len() as u64)
+        })
+    }
 }
 
 ///d Fields by which the query can be sorted
@@ -925,6 +1575,29 @@ pub trait SubscribeCallback: Send + Sync + 'static {
     fn event(&self, event: Arc<LiveEvent>) -> Result<(), CallbackError>;
 }
 
+/// Aggregate progress of a [`Doc::export_query`] call.
+#[derive(Debug, Clone)]
+pub struct ExportQueryProgress {
+    /// How many entries have been fully exported so far.
+    pub finished_entries: u64,
+    /// How many entries the query matched in total.
+    pub total_entries: u64,
+    /// How many content bytes have been exported so far.
+    pub finished_bytes: u64,
+}
+
+/// The `progress` method will be called once per finished entry during a
+/// `doc.export_query` call, with aggregate running totals.
+pub trait ExportQueryCallback: Send + Sync + 'static {
+    fn progress(&self, progress: ExportQueryProgress) -> Result<(), CallbackError>;
+}
+
+/// The `batch` method will be called with each coalesced batch of `LiveEvent`s emitted
+/// during a `doc.subscribe_batched`. See [`Doc::subscribe_batched`] for how batches are cut.
+pub trait SubscribeBatchCallback: Send + Sync + 'static {
+    fn batch(&self, events: Vec<Arc<LiveEvent>>) -> Result<(), CallbackError>;
+}
+
 /// Events informing about actions of the live sync progress
 #[derive(Debug, Serialize, Deserialize)]
 #[allow(clippy::large_enum_variant)]
@@ -1511,6 +2184,34 @@ mod tests {
         node.doc_join(doc_ticket).unwrap();
     }
 
+    #[test]
+    fn test_cached_doc_list() {
+        let iroh_dir = tempfile::tempdir().unwrap();
+        let path = iroh_dir.path().to_string_lossy().into_owned();
+        let node = IrohNode::new(path.clone()).unwrap();
+        node.doc_create().unwrap();
+        node.doc_create().unwrap();
+
+        let live = node.doc_list().unwrap();
+        assert_eq!(2, live.len());
+
+        // the snapshot is rewritten in the background; give it a moment to land
+        let mut cached = Vec::new();
+        for _ in 0..50 {
+            cached = cached_doc_list(path.clone()).unwrap_or_default();
+            if cached.len() == live.len() {
+                break;
+            }
+            std::thread::sleep(std::time::Duration::from_millis(100));
+        }
+
+        let mut live_ids: Vec<_> = live.iter().map(|d| d.namespace.clone()).collect();
+        let mut cached_ids: Vec<_> = cached.iter().map(|d| d.namespace.clone()).collect();
+        live_ids.sort();
+        cached_ids.sort();
+        assert_eq!(live_ids, cached_ids);
+    }
+
     #[test]
     fn test_basic_sync() {
         // create node_0
@@ -1681,6 +2382,68 @@ mod tests {
         assert_eq!(val, got_val);
         assert_eq!(val.len() as u64, entry.content_len());
     }
+    #[test]
+    fn test_set_bytes_batch() {
+        let path = tempfile::tempdir().unwrap();
+        let node = crate::IrohNode::new(path.path().to_string_lossy().into_owned()).unwrap();
+
+        // create doc and author
+        let doc = node.doc_create().unwrap();
+        let author = node.author_create().unwrap();
+
+        // insert a batch of entries
+        let num_entries = 10;
+        let entries = (0..num_entries)
+            .map(|i| BatchEntry {
+                author: author.clone(),
+                key: format!("key/{i}").into_bytes(),
+                value: format!("value {i}").into_bytes(),
+            })
+            .collect::<Vec<_>>();
+        let hashes = doc.set_bytes_batch(entries.clone()).unwrap();
+        assert_eq!(num_entries, hashes.len());
+
+        // hashes come back in entry order and resolve to the right content
+        for (entry, hash) in entries.iter().zip(hashes.iter()) {
+            let query = Query::author_key_exact(&author, entry.key.clone());
+            let got = doc.get_one(query.into()).unwrap().unwrap();
+            assert!(hash.equal(&got.content_hash()));
+            assert_eq!(entry.value, got.content_bytes(doc.clone()).unwrap());
+        }
+    }
+
+    #[test]
+    fn test_query_cursor() {
+        let path = tempfile::tempdir().unwrap();
+        let node = crate::IrohNode::new(path.path().to_string_lossy().into_owned()).unwrap();
+
+        // create doc and author, insert entries
+        let doc = node.doc_create().unwrap();
+        let author = node.author_create().unwrap();
+        let num_entries = 10;
+        for i in 0..num_entries {
+            doc.set_bytes(
+                &author,
+                format!("key/{i}").into_bytes(),
+                format!("value {i}").into_bytes(),
+            )
+            .unwrap();
+        }
+
+        // page through all entries
+        let cursor = doc.query_cursor(Query::all(None).into()).unwrap();
+        let mut got = 0;
+        loop {
+            let page = cursor.next_page(3).unwrap();
+            if page.is_empty() {
+                break;
+            }
+            assert!(page.len() <= 3);
+            got += page.len();
+        }
+        assert_eq!(num_entries, got);
+    }
+
     #[test]
     fn test_doc_import_export() {
         // create temp file
@@ -1726,4 +2489,70 @@ mod tests {
         let got_bytes = std::fs::read(path).unwrap();
         assert_eq!(buf, got_bytes);
     }
+
+    #[test]
+    fn test_export_query() {
+        // create temp files
+        let temp_dir = tempfile::tempdir().unwrap();
+        let in_root = temp_dir.path().join("in");
+        std::fs::create_dir_all(in_root.clone()).unwrap();
+        let out_root = temp_dir.path().join("out");
+
+        let num_files = 5;
+        let size = 100;
+        let mut contents = std::collections::HashMap::new();
+        for i in 0..num_files {
+            let name = format!("test-{i}");
+            let path = in_root.join(&name);
+            let mut buf = vec![0u8; size];
+            rand::thread_rng().fill_bytes(&mut buf);
+            let mut file = std::fs::File::create(path).unwrap();
+            file.write_all(&buf).unwrap();
+            file.flush().unwrap();
+            contents.insert(name, buf);
+        }
+
+        // spawn node
+        let iroh_dir = tempfile::tempdir().unwrap();
+        let node = crate::IrohNode::new(iroh_dir.path().to_string_lossy().into_owned()).unwrap();
+
+        // create doc & author
+        let doc = node.doc_create().unwrap();
+        let author = node.author_create().unwrap();
+
+        // import files
+        let in_root_str = in_root.to_string_lossy().into_owned();
+        for name in contents.keys() {
+            let path_str = in_root.join(name).to_string_lossy().into_owned();
+            let key = crate::path_to_key(path_str.clone(), None, Some(in_root_str.clone())).unwrap();
+            doc.import_file(author.clone(), key, path_str, true, None)
+                .unwrap();
+        }
+
+        // export everything in one call
+        let out_root_str = out_root.to_string_lossy().into_owned();
+        let exported = doc
+            .export_query(Query::all(None).into(), out_root_str, 4, None)
+            .unwrap();
+        assert_eq!(exported, num_files as u64);
+
+        for (name, buf) in contents {
+            let got_bytes = std::fs::read(out_root.join(name)).unwrap();
+            assert_eq!(buf, got_bytes);
+        }
+
+        // a key escaping the destination root must fail the export, not write outside it
+        doc.set_bytes(&author, b"/../escape\0".to_vec(), b"evil".to_vec())
+            .unwrap();
+        let out_root = temp_dir.path().join("out2");
+        assert!(doc
+            .export_query(
+                Query::all(None).into(),
+                out_root.to_string_lossy().into_owned(),
+                4,
+                None,
+            )
+            .is_err());
+        assert!(!temp_dir.path().join("escape").exists());
+    }
 }
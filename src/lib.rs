@@ -73,6 +73,31 @@ fn block_on<F: Future<Output = T>, T>(rt: &tokio::runtime::Handle, fut: F) -> T
     })
 }
 
+/// Run `fut` on the node's tokio runtime without blocking the calling thread.
+///
+/// This is the async counterpart to [`block_on`]: the work is spawned onto the
+/// internal runtime and the returned future only waits for completion, so it can
+/// be polled from the uniffi rust-future machinery. Dropping the returned future
+/// (e.g. via `rust_future_cancel`) aborts the spawned task.
+async fn spawn_on<F, T>(rt: &tokio::runtime::Handle, fut: F) -> Result<T, IrohError>
+where
+    F: Future<Output = Result<T, IrohError>> + Send + 'static,
+    T: Send + 'static,
+{
+    struct AbortOnDrop<T>(tokio::task::JoinHandle<T>);
+    impl<T> Drop for AbortOnDrop<T> {
+        fn drop(&mut self) {
+            self.0.abort();
+        }
+    }
+
+    let mut task = AbortOnDrop(rt.spawn(fut));
+    match (&mut task.0).await {
+        Ok(res) => res,
+        Err(err) => Err(anyhow::Error::from(err).into()),
+    }
+}
+
 /// Helper function that translates a key that was derived from the [`path_to_key`] function back
 /// into a path.
 ///
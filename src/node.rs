@@ -1,12 +1,20 @@
-use std::{collections::HashMap, path::PathBuf, sync::Arc, time::Duration};
+use std::{
+    collections::HashMap,
+    path::PathBuf,
+    sync::{
+        atomic::{AtomicU64, Ordering},
+        Arc, Mutex,
+    },
+    time::Duration,
+};
 
-use futures::stream::TryStreamExt;
+use futures::{stream::TryStreamExt, StreamExt};
 use iroh::{
     client::MemIroh,
-    node::{Builder, FsNode},
+    node::{Builder, FsNode, MemNode},
 };
 
-use crate::{block_on, IrohError, NodeAddr, PublicKey};
+use crate::{block_on, CallbackError, IrohError, NodeAddr, PublicKey};
 
 /// Stats counter
 /// Counter stats
@@ -18,6 +26,78 @@ pub struct CounterStats {
     pub description: String,
 }
 
+/// The FFI entry points that record built-in latency histograms.
+#[derive(Debug)]
+pub enum FfiMetric {
+    /// Calls to `blobs_read_to_bytes`.
+    BlobsReadToBytes,
+    /// Calls to `Doc.set_bytes`.
+    DocSetBytes,
+    /// Calls to `blobs_download`.
+    BlobsDownload,
+}
+
+/// A lock-free power-of-two latency histogram.
+///
+/// Bucket `i` counts calls that took less than `2^i` microseconds; the last bucket absorbs
+/// everything slower. Recording is a few relaxed atomic increments, cheap enough to sit on
+/// the hot FFI paths unconditionally.
+pub(crate) struct LatencyHistogram {
+    count: AtomicU64,
+    sum_micros: AtomicU64,
+    buckets: [AtomicU64; Self::NUM_BUCKETS],
+}
+
+impl LatencyHistogram {
+    const NUM_BUCKETS: usize = 32;
+
+    const fn new() -> Self {
+        #[allow(clippy::declare_interior_mutable_const)]
+        const ZERO: AtomicU64 = AtomicU64::new(0);
+        LatencyHistogram {
+            count: ZERO,
+            sum_micros: ZERO,
+            buckets: [ZERO; Self::NUM_BUCKETS],
+        }
+    }
+
+    pub(crate) fn record(&self, elapsed: Duration) {
+        let micros = u64::try_from(elapsed.as_micros()).unwrap_or(u64::MAX);
+        let bucket = (64 - micros.leading_zeros() as usize).min(Self::NUM_BUCKETS - 1);
+        self.count.fetch_add(1, Ordering::Relaxed);
+        self.sum_micros.fetch_add(micros, Ordering::Relaxed);
+        self.buckets[bucket].fetch_add(1, Ordering::Relaxed);
+    }
+
+    /// Serialize the histogram as 34 little-endian `u64`s: count, sum of microseconds, then
+    /// the bucket counts.
+    fn snapshot(&self) -> Vec<u8> {
+        let mut buf = Vec::with_capacity((2 + Self::NUM_BUCKETS) * 8);
+        buf.extend_from_slice(&self.count.load(Ordering::Relaxed).to_le_bytes());
+        buf.extend_from_slice(&self.sum_micros.load(Ordering::Relaxed).to_le_bytes());
+        for bucket in &self.buckets {
+            buf.extend_from_slice(&bucket.load(Ordering::Relaxed).to_le_bytes());
+        }
+        buf
+    }
+}
+
+static FFI_HISTOGRAMS: [LatencyHistogram; 3] = [
+    LatencyHistogram::new(),
+    LatencyHistogram::new(),
+    LatencyHistogram::new(),
+];
+
+/// The histogram backing `metric`. Histograms are process-wide, like the global metrics
+/// collection started by `start_metrics_collection`.
+pub(crate) fn ffi_histogram(metric: &FfiMetric) -> &'static LatencyHistogram {
+    match metric {
+        FfiMetric::BlobsReadToBytes => &FFI_HISTOGRAMS[0],
+        FfiMetric::DocSetBytes => &FFI_HISTOGRAMS[1],
+        FfiMetric::BlobsDownload => &FFI_HISTOGRAMS[2],
+    }
+}
+
 /// Information about a direct address.
 #[derive(Debug, Clone)]
 pub struct DirectAddrInfo(pub(crate) iroh::net::endpoint::DirectAddrInfo);
@@ -97,8 +177,40 @@ impl From<iroh::net::endpoint::ConnectionInfo> for ConnectionInfo {
     }
 }
 
+/// The kind of change a `subscribe_connections` event reports.
+#[derive(Debug, Clone)]
+pub enum ConnectionEventType {
+    /// A peer we had no connection to appeared.
+    Connected,
+    /// A peer we were connected to disappeared.
+    Disconnected,
+    /// The connection type to a peer changed, e.g. a direct path fell back to relay.
+    TypeChanged,
+    /// The latency to a peer crossed the subscription's threshold, in either direction.
+    LatencyCrossed,
+}
+
+/// A delta pushed by `IrohNode::subscribe_connections`.
+#[derive(Debug, Clone)]
+pub struct ConnectionEvent {
+    /// The kind of change this event reports.
+    pub r#type: ConnectionEventType,
+    /// The peer the change concerns.
+    pub node_id: Arc<PublicKey>,
+    /// The current connection type to the peer; `None` for `Disconnected` events.
+    pub conn_type: Arc<ConnectionType>,
+    /// The current latency to the peer, if known.
+    pub latency: Option<Duration>,
+}
+
+/// The `event` method will be called for each `ConnectionEvent` emitted by a
+/// `node.subscribe_connections` subscription. Returning an error cancels the subscription.
+pub trait ConnectionCallback: Send + Sync + 'static {
+    fn event(&self, event: ConnectionEvent) -> Result<(), CallbackError>;
+}
+
 /// The type of the connection
-#[derive(Debug)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
 pub enum ConnType {
     /// Indicates you have a UDP connection.
     Direct,
@@ -194,6 +306,20 @@ pub struct NodeOptions {
     /// How frequently the blob store should clean up unreferenced blobs, in milliseconds.
     /// Set to 0 to disable gc
     pub gc_interval_millis: Option<u64>,
+    /// The number of worker threads for the internal tokio runtime.
+    ///
+    /// Defaults to 2. Raise this to give iroh more cores on large machines, or leave it at
+    /// the default to keep the footprint small on edge devices.
+    pub worker_thread_count: Option<u32>,
+    /// Whether to use relay servers to hole punch and relay traffic.
+    ///
+    /// Defaults to true, using the default n0 relay servers. Set to false to disable relaying
+    /// entirely and only connect over direct addresses.
+    pub relay_enabled: Option<bool>,
+    /// The port to bind the iroh socket to. The same port is used for IPv4 and IPv6.
+    ///
+    /// Defaults to a random free port.
+    pub bind_port: Option<u16>,
 }
 
 impl From<NodeOptions> for iroh::node::Builder<iroh::blobs::store::mem::Store> {
@@ -209,6 +335,17 @@ impl From<NodeOptions> for iroh::node::Builder<iroh::blobs::store::mem::Store> {
             };
         }
 
+        if let Some(enabled) = value.relay_enabled {
+            b = match enabled {
+                true => b.relay_mode(iroh::net::relay::RelayMode::Default),
+                false => b.relay_mode(iroh::net::relay::RelayMode::Disabled),
+            };
+        }
+
+        if let Some(port) = value.bind_port {
+            b = b.bind_port(port);
+        }
+
         b
     }
 }
@@ -217,16 +354,50 @@ impl Default for NodeOptions {
     fn default() -> Self {
         NodeOptions {
             gc_interval_millis: Some(0),
+            worker_thread_count: None,
+            relay_enabled: None,
+            bind_port: None,
+        }
+    }
+}
+
+/// The spawned node backing an [`IrohNode`]: persistent on disk or fully in memory.
+pub(crate) enum InnerNode {
+    Fs(FsNode),
+    Mem(MemNode),
+}
+
+impl InnerNode {
+    fn node_id(&self) -> iroh::net::NodeId {
+        match self {
+            InnerNode::Fs(node) => node.node_id(),
+            InnerNode::Mem(node) => node.node_id(),
+        }
+    }
+
+    fn endpoint(&self) -> &iroh::net::Endpoint {
+        match self {
+            InnerNode::Fs(node) => node.endpoint(),
+            InnerNode::Mem(node) => node.endpoint(),
         }
     }
 }
 
 /// An Iroh node. Allows you to sync, store, and transfer data.
 pub struct IrohNode {
-    pub(crate) node: FsNode,
+    pub(crate) node: InnerNode,
     pub(crate) sync_client: MemIroh,
     #[allow(dead_code)]
     pub(crate) tokio_rt: Option<tokio::runtime::Runtime>,
+    /// Connections established via [`IrohNode::connect`]/[`IrohNode::preconnect`], held so
+    /// they stay warm for later transfers. Dead entries are pruned on every
+    /// connect/preconnect call, so the map is bounded by the set of live connections.
+    pub(crate) warm_connections: Mutex<HashMap<iroh::net::NodeId, iroh::net::endpoint::Connection>>,
+    /// Shared doc handles by namespace id, for [`IrohNode::doc_open_shared`].
+    pub(crate) open_docs: Mutex<HashMap<String, std::sync::Weak<crate::Doc>>>,
+    /// The data directory of a persistent node, where the doc-list snapshot for
+    /// [`crate::cached_doc_list`] is maintained. None for in-memory nodes.
+    pub(crate) data_dir: Option<PathBuf>,
 }
 
 impl IrohNode {
@@ -237,6 +408,28 @@ impl IrohNode {
         }
     }
 
+    /// Whether this node is backed by the in-memory store.
+    pub(crate) fn is_memory(&self) -> bool {
+        matches!(self.node, InnerNode::Mem(_))
+    }
+
+    /// Rewrite the on-disk doc-list snapshot for [`crate::cached_doc_list`] in the background.
+    ///
+    /// Best-effort: failures are logged and never surfaced, and the snapshot is only
+    /// maintained for persistent nodes.
+    pub(crate) fn refresh_doc_list_snapshot(&self) {
+        let data_dir = match self.data_dir.clone() {
+            Some(data_dir) => data_dir,
+            None => return,
+        };
+        let client = self.sync_client.clone();
+        self.rt().spawn(async move {
+            if let Err(err) = crate::doc::persist_doc_list_snapshot(&client, data_dir).await {
+                println!("rpc error: {:?}", err);
+            }
+        });
+    }
+
     /// Create a new iroh node. The `path` param should be a directory where we can store or load
     /// iroh data from a previous session.
     pub fn new(path: String) -> Result<Self, IrohError> {
@@ -246,9 +439,10 @@ impl IrohNode {
 
     /// Create a new iroh node with options.
     pub fn with_options(path: String, options: NodeOptions) -> Result<Self, IrohError> {
+        let worker_threads = options.worker_thread_count.unwrap_or(2) as usize;
         let tokio_rt = tokio::runtime::Builder::new_multi_thread()
             .thread_name("main-runtime")
-            .worker_threads(2)
+            .worker_threads(worker_threads)
             .enable_all()
             .build()
             .map_err(anyhow::Error::from)?;
@@ -262,19 +456,72 @@ impl IrohNode {
         Ok(node)
     }
 
+    /// Create a new in-memory iroh node.
+    ///
+    /// The node keeps all data — blobs, docs, keys — in memory and leaves no state on disk,
+    /// so there is no data directory to create and no fsync traffic during ingest. Startup is
+    /// an order of magnitude faster than a persistent node, at the cost of losing everything
+    /// when the node is dropped. Intended for ephemeral workloads like transfer caches and
+    /// tests.
+    pub fn memory() -> Result<Self, IrohError> {
+        Self::memory_with_options(NodeOptions::default())
+    }
+
+    /// Create a new in-memory iroh node with options.
+    pub fn memory_with_options(options: NodeOptions) -> Result<Self, IrohError> {
+        let worker_threads = options.worker_thread_count.unwrap_or(2) as usize;
+        let tokio_rt = tokio::runtime::Builder::new_multi_thread()
+            .thread_name("main-runtime")
+            .worker_threads(worker_threads)
+            .enable_all()
+            .build()
+            .map_err(anyhow::Error::from)?;
+        let rt = tokio_rt.handle().clone();
+
+        let node = block_on(&rt, async move {
+            Self::new_inner_memory(options, Some(tokio_rt)).await
+        })?;
+
+        Ok(node)
+    }
+
     pub(crate) async fn new_inner(
         path: PathBuf,
         options: NodeOptions,
         tokio_rt: Option<tokio::runtime::Runtime>,
     ) -> Result<Self, anyhow::Error> {
         let builder: Builder<iroh::blobs::store::mem::Store> = options.into();
-        let node = builder.persist(path).await?.spawn().await?;
+        let node = builder.persist(path.clone()).await?.spawn().await?;
+        let sync_client = node.clone().client().clone();
+
+        let node = IrohNode {
+            node: InnerNode::Fs(node),
+            sync_client,
+            tokio_rt,
+            warm_connections: Mutex::new(HashMap::new()),
+            open_docs: Mutex::new(HashMap::new()),
+            data_dir: Some(path),
+        };
+        // bring the doc-list snapshot up to date with whatever this session loaded
+        node.refresh_doc_list_snapshot();
+        Ok(node)
+    }
+
+    pub(crate) async fn new_inner_memory(
+        options: NodeOptions,
+        tokio_rt: Option<tokio::runtime::Runtime>,
+    ) -> Result<Self, anyhow::Error> {
+        let builder: Builder<iroh::blobs::store::mem::Store> = options.into();
+        let node = builder.spawn().await?;
         let sync_client = node.clone().client().clone();
 
         Ok(IrohNode {
-            node,
+            node: InnerNode::Mem(node),
             sync_client,
             tokio_rt,
+            warm_connections: Mutex::new(HashMap::new()),
+            open_docs: Mutex::new(HashMap::new()),
+            data_dir: None,
         })
     }
 
@@ -302,6 +549,50 @@ impl IrohNode {
         })
     }
 
+    /// The names of all counters reported by [`Self::stats`], in a stable sorted order.
+    ///
+    /// Fetch this once and pair it with [`Self::stats_values_raw`] for cheap repeated
+    /// scrapes: the values buffer uses the same order as this list.
+    pub fn stats_keys(&self) -> Result<Vec<String>, IrohError> {
+        block_on(&self.rt(), async {
+            let stats = self.sync_client.stats().await?;
+            let mut keys: Vec<String> = stats.into_keys().collect();
+            keys.sort();
+            Ok(keys)
+        })
+    }
+
+    /// The current counter values as one flat binary buffer.
+    ///
+    /// The buffer holds one little-endian `u64` per counter, back to back, sorted by counter
+    /// name — the same order as [`Self::stats_keys`]. This avoids lowering a string-keyed map
+    /// on every scrape: read the keys once, then memcpy this buffer on each interval.
+    pub fn stats_values_raw(&self) -> Result<Vec<u8>, IrohError> {
+        block_on(&self.rt(), async {
+            let stats = self.sync_client.stats().await?;
+            let mut stats: Vec<(String, u64)> =
+                stats.into_iter().map(|(k, v)| (k, v.value)).collect();
+            stats.sort_by(|a, b| a.0.cmp(&b.0));
+
+            let mut buf = Vec::with_capacity(stats.len() * 8);
+            for (_, value) in stats {
+                buf.extend_from_slice(&value.to_le_bytes());
+            }
+            Ok(buf)
+        })
+    }
+
+    /// A snapshot of the FFI-side latency histogram for `metric`, as one flat binary buffer.
+    ///
+    /// Latencies are recorded around the hot FFI entry points themselves (including the
+    /// uniffi dispatch and any blocking on the internal runtime), so the numbers reflect what
+    /// the foreign caller actually waits. The buffer layout is fixed: 34 little-endian `u64`s —
+    /// total call count, total latency in microseconds, then 32 bucket counts where bucket `i`
+    /// holds calls that took less than `2^i` microseconds (the last bucket absorbs the rest).
+    pub fn latency_histogram_raw(&self, metric: FfiMetric) -> Vec<u8> {
+        ffi_histogram(&metric).snapshot()
+    }
+
     /// Return `ConnectionInfo`s for each connection we have to another iroh node.
     pub fn connections(&self) -> Result<Vec<ConnectionInfo>, IrohError> {
         block_on(&self.rt(), async {
@@ -331,6 +622,165 @@ impl IrohNode {
         })
     }
 
+    /// Subscribe to connection changes instead of polling [`Self::connections`].
+    ///
+    /// An internal task samples the connection table every `interval_millis` and pushes only
+    /// the deltas through `cb`: peer connected, peer disconnected, connection type changed
+    /// (e.g. direct fell back to relay), and — if `latency_threshold_millis` is set — the
+    /// latency to a peer crossing that threshold in either direction. Nothing crosses the
+    /// FFI while the table is unchanged. Returning an error from the callback cancels the
+    /// subscription.
+    pub fn subscribe_connections(
+        &self,
+        interval_millis: u64,
+        latency_threshold_millis: Option<u64>,
+        cb: Arc<dyn ConnectionCallback>,
+    ) -> Result<(), IrohError> {
+        let client = self.sync_client.clone();
+        let interval = Duration::from_millis(interval_millis.max(1));
+        let threshold = latency_threshold_millis.map(Duration::from_millis);
+        self.rt().spawn(async move {
+            // last seen connection type and latency per peer
+            let mut known: HashMap<iroh::net::NodeId, (ConnType, Option<Duration>)> =
+                HashMap::new();
+            loop {
+                let infos: Vec<iroh::net::endpoint::ConnectionInfo> = match async {
+                    client.connections().await?.try_collect().await
+                }
+                .await
+                {
+                    Ok(infos) => infos,
+                    Err(err) => {
+                        println!("rpc error: {:?}", err);
+                        tokio::time::sleep(interval).await;
+                        continue;
+                    }
+                };
+
+                let mut events = Vec::new();
+                let current: HashMap<iroh::net::NodeId, iroh::net::endpoint::ConnectionInfo> =
+                    infos.into_iter().map(|info| (info.node_id, info)).collect();
+
+                for node_id in known.keys() {
+                    if !current.contains_key(node_id) {
+                        events.push(ConnectionEvent {
+                            r#type: ConnectionEventType::Disconnected,
+                            node_id: Arc::new((*node_id).into()),
+                            conn_type: Arc::new(ConnectionType::None),
+                            latency: None,
+                        });
+                    }
+                }
+
+                for (node_id, info) in &current {
+                    let conn_type: ConnectionType = info.conn_type.clone().into();
+                    let event_type = match known.get(node_id) {
+                        None => Some(ConnectionEventType::Connected),
+                        Some((prev_type, _)) if *prev_type != conn_type.r#type() => {
+                            Some(ConnectionEventType::TypeChanged)
+                        }
+                        Some((_, prev_latency)) => {
+                            let crossed = match (threshold, prev_latency, info.latency) {
+                                (Some(threshold), Some(prev), Some(cur)) => {
+                                    (*prev >= threshold) != (cur >= threshold)
+                                }
+                                _ => false,
+                            };
+                            crossed.then_some(ConnectionEventType::LatencyCrossed)
+                        }
+                    };
+                    if let Some(r#type) = event_type {
+                        events.push(ConnectionEvent {
+                            r#type,
+                            node_id: Arc::new((*node_id).into()),
+                            conn_type: Arc::new(info.conn_type.clone().into()),
+                            latency: info.latency,
+                        });
+                    }
+                }
+
+                known = current
+                    .into_iter()
+                    .map(|(node_id, info)| {
+                        let conn_type: ConnectionType = info.conn_type.into();
+                        (node_id, (conn_type.r#type(), info.latency))
+                    })
+                    .collect();
+
+                for event in events {
+                    if let Err(err) = cb.event(event) {
+                        println!("cb error: {:?}", err);
+                        return;
+                    }
+                }
+
+                tokio::time::sleep(interval).await;
+            }
+        });
+
+        Ok(())
+    }
+
+    /// Establish a connection to another node ahead of any transfer.
+    ///
+    /// Pays the full dial cost — discovery, hole punching, possible relay fallback — now,
+    /// and holds the connection so a later [`crate::IrohNode::blobs_download`] from that node
+    /// starts at wire speed instead of inside the download call. Connecting again to the
+    /// same node replaces the held connection.
+    pub fn connect(&self, addr: Arc<NodeAddr>) -> Result<(), IrohError> {
+        self.prune_warm_connections();
+        block_on(&self.rt(), async {
+            let addr: iroh::net::endpoint::NodeAddr = (*addr).clone().try_into()?;
+            let node_id = addr.node_id;
+            let conn = self
+                .node
+                .endpoint()
+                .connect(addr, iroh::blobs::protocol::ALPN)
+                .await?;
+            self.warm_connections.lock().unwrap().insert(node_id, conn);
+            Ok(())
+        })
+    }
+
+    /// Drop held warm connections that have since died (idle timeout, peer gone), so the
+    /// map tracks live connections instead of growing with every peer ever dialed.
+    fn prune_warm_connections(&self) {
+        self.warm_connections
+            .lock()
+            .unwrap()
+            .retain(|_, conn| conn.close_reason().is_none());
+    }
+
+    /// Warm connections to several nodes concurrently.
+    ///
+    /// Like [`Self::connect`] for each given address, with the dials in flight at the same
+    /// time. Unreachable nodes are skipped rather than failing the whole call; returns how
+    /// many connections were established.
+    pub fn preconnect(&self, addrs: Vec<Arc<NodeAddr>>) -> Result<u64, IrohError> {
+        self.prune_warm_connections();
+        block_on(&self.rt(), async {
+            let mut results = futures::stream::iter(addrs.into_iter().map(|addr| {
+                let endpoint = self.node.endpoint().clone();
+                async move {
+                    let addr: iroh::net::endpoint::NodeAddr = (*addr).clone().try_into()?;
+                    let node_id = addr.node_id;
+                    let conn = endpoint.connect(addr, iroh::blobs::protocol::ALPN).await?;
+                    Ok::<_, IrohError>((node_id, conn))
+                }
+            }))
+            .buffer_unordered(16);
+
+            let mut connected = 0;
+            while let Some(res) = results.next().await {
+                if let Ok((node_id, conn)) = res {
+                    self.warm_connections.lock().unwrap().insert(node_id, conn);
+                    connected += 1;
+                }
+            }
+            Ok(connected)
+        })
+    }
+
     /// Get status information about a node
     pub fn status(&self) -> Result<Arc<NodeStatus>, IrohError> {
         block_on(&self.rt(), async {
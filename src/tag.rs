@@ -2,7 +2,7 @@ use std::sync::Arc;
 
 use crate::{block_on, BlobFormat, Hash, IrohError, IrohNode};
 use bytes::Bytes;
-use futures::TryStreamExt;
+use futures::{StreamExt, TryStreamExt};
 
 /// A response to a list collections request
 pub struct TagInfo {
@@ -51,4 +51,29 @@ impl IrohNode {
             Ok(())
         })
     }
+
+    /// Delete many tags in a single call.
+    ///
+    /// The whole batch crosses the FFI once and the deletions are issued to the store
+    /// concurrently, so a retention run over thousands of tags is much cheaper than calling
+    /// [`Self::tags_delete`] per tag. The blobs the tags kept alive are reclaimed by the next
+    /// gc sweep (see `gc_interval_millis` in `NodeOptions`).
+    pub fn tags_delete_batch(&self, names: Vec<Vec<u8>>) -> Result<(), IrohError> {
+        block_on(&self.rt(), async {
+            futures::stream::iter(names.into_iter().map(|name| {
+                let client = self.sync_client.clone();
+                async move {
+                    client
+                        .tags()
+                        .delete(iroh::blobs::Tag(Bytes::from(name)))
+                        .await?;
+                    Ok::<_, IrohError>(())
+                }
+            }))
+            .buffer_unordered(16)
+            .try_collect::<Vec<_>>()
+            .await?;
+            Ok(())
+        })
+    }
 }